@@ -0,0 +1,73 @@
+/**
+ * Benchmark: Float16 <-> Float32 array conversion
+ *
+ * Compares the bulk kernels behind `JuliaArray.toFloat32()` and
+ * `JuliaArray.fromFloat32AsFloat16()` (F16C / NEON when available) with
+ * converting through a Julia broadcast.
+ */
+
+import { FORMAT_MD, suite } from "@thi.ng/bench";
+import { jlbun, Julia, JuliaArray } from "../../jlbun/index.js";
+
+Julia.init({ project: null });
+
+const genArray = (n: number) => {
+  const arr = new Float32Array(n);
+  for (let i = 0; i < n; i++) {
+    arr[i] = Math.random() * 100;
+  }
+  return arr;
+};
+
+const arr1000 = genArray(1000);
+const arr100000 = genArray(100000);
+const arr1000000 = genArray(1000000);
+
+const half1000 = JuliaArray.fromFloat32AsFloat16(arr1000);
+const half100000 = JuliaArray.fromFloat32AsFloat16(arr100000);
+const half1000000 = JuliaArray.fromFloat32AsFloat16(arr1000000);
+
+const juliaWiden = (arr: JuliaArray) =>
+  (Julia.Base.broadcast(Julia.Float32, arr) as JuliaArray).value;
+
+const juliaNarrow = (arr: Float32Array) =>
+  Julia.Base.broadcast(Julia.Float16, JuliaArray.from(arr));
+
+console.log(
+  `SIMD kernels: ${jlbun.symbols.jlbun_f16_simd() ? "enabled" : "disabled"}`,
+);
+
+suite(
+  [
+    { title: "julia Float32.(x) of 1000", fn: () => juliaWiden(half1000) },
+    { title: "toFloat32 of 1000", fn: () => half1000.toFloat32() },
+    { title: "julia Float32.(x) of 100000", fn: () => juliaWiden(half100000) },
+    { title: "toFloat32 of 100000", fn: () => half100000.toFloat32() },
+    {
+      title: "julia Float32.(x) of 1000000",
+      fn: () => juliaWiden(half1000000),
+    },
+    { title: "toFloat32 of 1000000", fn: () => half1000000.toFloat32() },
+    { title: "julia Float16.(x) of 1000", fn: () => juliaNarrow(arr1000) },
+    {
+      title: "fromFloat32AsFloat16 of 1000",
+      fn: () => JuliaArray.fromFloat32AsFloat16(arr1000),
+    },
+    {
+      title: "julia Float16.(x) of 1000000",
+      fn: () => juliaNarrow(arr1000000),
+    },
+    {
+      title: "fromFloat32AsFloat16 of 1000000",
+      fn: () => JuliaArray.fromFloat32AsFloat16(arr1000000),
+    },
+  ],
+  {
+    iter: 10,
+    size: 100,
+    warmup: 5,
+    format: FORMAT_MD,
+  },
+);
+
+Julia.close();
@@ -44,4 +44,27 @@ suite(
   },
 );
 
+// Chunked map over Julia threads; compare runs with different
+// JULIA_NUM_THREADS. Each call also waits for the next completion poll
+// (up to 1 ms).
+const PARALLEL_ITERATIONS = 20;
+
+const parallelFn = (arr: Float64Array) =>
+  Julia.scopeAsync(async (julia) => {
+    const xs = julia.Array.from(arr);
+    return (await Julia.parallel.map(julia.Base.sin, xs)).length;
+  });
+
+console.log();
+console.log(`Parallel sin on ${Julia.nthreads} Julia threads`);
+for (const arr of [arr10000, arr100000, arr1000000]) {
+  await parallelFn(arr); // Warm up
+  const start = performance.now();
+  for (let i = 0; i < PARALLEL_ITERATIONS; i++) {
+    await parallelFn(arr);
+  }
+  const elapsed = (performance.now() - start) / PARALLEL_ITERATIONS;
+  console.log(`julia parallel sin of ${arr.length}: ${elapsed.toFixed(3)} ms`);
+}
+
 Julia.close();
@@ -0,0 +1,80 @@
+/**
+ * Benchmark: compiled native entry points vs dynamic calls
+ *
+ * Compares calling a Julia function through:
+ * 1. Julia.call() - boxing, dynamic dispatch and result wrapping
+ * 2. JuliaFunction.compile() - `@cfunction` entry point via Bun's CFunction
+ * 3. Plain JS - baseline
+ */
+
+import { ptr } from "bun:ffi";
+import { Julia, JuliaFunction } from "../../jlbun/index.js";
+
+Julia.init();
+
+const ITERATIONS = 100_000;
+
+// Helper to format numbers with commas
+const formatNum = (n: number) =>
+  n.toFixed(0).replace(/\B(?=(\d{3})+(?!\d))/g, ",");
+
+const report = (title: string, fn: () => void) => {
+  // Warm up
+  for (let i = 0; i < 1000; i++) {
+    fn();
+  }
+
+  console.log(title);
+  console.log("-".repeat(50));
+  const start = performance.now();
+  for (let i = 0; i < ITERATIONS; i++) {
+    fn();
+  }
+  const elapsed = performance.now() - start;
+  console.log(`   Total time: ${elapsed.toFixed(2)} ms`);
+  console.log(
+    `   Per operation: ${((elapsed * 1000) / ITERATIONS).toFixed(3)} µs`,
+  );
+  console.log(`   Ops/sec: ${formatNum(ITERATIONS / (elapsed / 1000))}`);
+  console.log();
+};
+
+console.log("=".repeat(70));
+console.log("Compiled Function Benchmark");
+console.log("=".repeat(70));
+console.log(`Iterations per test: ${formatNum(ITERATIONS)}`);
+console.log();
+
+Julia.scope((julia) => {
+  // Scalar function
+  const sin = julia.Base.sin;
+  const compiledSin = sin.compile("(f64) -> f64");
+
+  report("1. Julia.call(sin, x)", () => {
+    julia.untracked(() => Julia.call(sin, 0.5));
+  });
+  report("2. sin.compile('(f64) -> f64')(x)", () => {
+    compiledSin(0.5);
+  });
+  report("3. Math.sin(x)", () => {
+    Math.sin(0.5);
+  });
+
+  // Pointer + length kernel
+  const data = new Float64Array(1000).map(() => Math.random());
+  const dataPtr = ptr(data);
+  const sumKernel = julia.eval(
+    "(p::Ptr{Nothing}, n::Int64) -> sum(unsafe_wrap(Array, Ptr{Float64}(p), n))",
+  ) as JuliaFunction;
+  const compiledSum = sumKernel.compile("(ptr, i64) -> f64");
+  const jlData = julia.Array.from(data);
+
+  report("4. Julia.call(sum, array)", () => {
+    julia.untracked(() => Julia.call(julia.Base.sum, jlData));
+  });
+  report("5. kernel.compile('(ptr, i64) -> f64')(ptr, n)", () => {
+    compiledSum(dataPtr, data.length);
+  });
+});
+
+Julia.close();
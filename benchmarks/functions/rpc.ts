@@ -0,0 +1,73 @@
+/**
+ * Benchmark: pipelined RPC throughput
+ *
+ * Compares running many short Julia calls through:
+ * 1. Julia.call() - one blocking FFI crossing per call on the JS thread
+ * 2. Julia.rpc.call() - calls pipelined through the submission ring to a
+ *    pool of worker tasks, results resolved in batches
+ *
+ * Run with several Julia threads (e.g. `JULIA_NUM_THREADS=4`) so the workers
+ * do not share the JS thread. The worker function does a little work per
+ * call so that the pool has something to parallelize.
+ */
+
+import { Julia, JuliaFunction } from "../../jlbun/index.js";
+
+Julia.init();
+
+const CALLS = 20_000;
+const WORK = 2_000;
+
+// Helper to format numbers with commas
+const formatNum = (n: number) =>
+  n.toFixed(0).replace(/\B(?=(\d{3})+(?!\d))/g, ",");
+
+const report = (title: string, elapsed: number) => {
+  console.log(title);
+  console.log("-".repeat(50));
+  console.log(`   Total time: ${elapsed.toFixed(2)} ms`);
+  console.log(`   Per call: ${((elapsed * 1000) / CALLS).toFixed(3)} µs`);
+  console.log(`   Calls/sec: ${formatNum(CALLS / (elapsed / 1000))}`);
+  console.log();
+};
+
+console.log("=".repeat(70));
+console.log("RPC Throughput Benchmark");
+console.log("=".repeat(70));
+console.log(`Calls per test: ${formatNum(CALLS)}`);
+console.log(`Julia threads: ${Julia.nthreads}`);
+console.log();
+
+await Julia.scopeAsync(async (julia) => {
+  const work = julia.eval(
+    "n -> (s = 0.0; for i in 1:n; s += sin(i); end; s)",
+  ) as JuliaFunction;
+  // Compile before timing
+  Julia.call(work, WORK);
+
+  let start = performance.now();
+  for (let i = 0; i < CALLS; i++) {
+    julia.untracked(() => Julia.call(work, WORK));
+  }
+  report("1. Julia.call(f, n)", performance.now() - start);
+
+  for (const workers of [1, Math.max(Julia.nthreads - 1, 1)]) {
+    Julia.rpc.start({ workers });
+    // Warm up the pool
+    await Promise.all(
+      Array.from({ length: 100 }, () => Julia.rpc.call(work, WORK)),
+    );
+
+    start = performance.now();
+    await Promise.all(
+      Array.from({ length: CALLS }, () => Julia.rpc.call(work, WORK)),
+    );
+    report(
+      `2. Julia.rpc.call(f, n) with ${workers} worker(s)`,
+      performance.now() - start,
+    );
+    await Julia.rpc.stop();
+  }
+});
+
+Julia.close();
@@ -0,0 +1,63 @@
+/**
+ * Benchmark: repeated templated and plain evaluation
+ *
+ * Compares evaluating the same expression many times through:
+ * 1. Julia.eval(code) - parsed, lowered and inferred on every call, with
+ *    the value baked into the source
+ * 2. Julia.tagEval`...${x}...` - compiled once per template, later calls
+ *    only pass the value
+ * 3. Julia.eval(code, { cache: true }) - compiled once into a cached thunk
+ */
+
+import { Julia } from "../../jlbun/index.js";
+
+Julia.init();
+
+const ITERATIONS = 2_000;
+
+// Helper to format numbers with commas
+const formatNum = (n: number) =>
+  n.toFixed(0).replace(/\B(?=(\d{3})+(?!\d))/g, ",");
+
+const report = (title: string, elapsed: number) => {
+  console.log(title);
+  console.log("-".repeat(50));
+  console.log(`   Total time: ${elapsed.toFixed(2)} ms`);
+  console.log(`   Per eval: ${((elapsed * 1000) / ITERATIONS).toFixed(3)} µs`);
+  console.log(`   Evals/sec: ${formatNum(ITERATIONS / (elapsed / 1000))}`);
+  console.log();
+};
+
+console.log("=".repeat(70));
+console.log("Templated Eval Benchmark");
+console.log("=".repeat(70));
+console.log(`Evaluations per test: ${formatNum(ITERATIONS)}`);
+console.log();
+
+Julia.scope((julia) => {
+  let start = performance.now();
+  for (let i = 0; i < ITERATIONS; i++) {
+    julia.untracked(() => {
+      julia.eval(`let x = ${i}; x > 100 ? sqrt(x) : 2x end`);
+    });
+  }
+  report("1. Julia.eval(interpolated source)", performance.now() - start);
+
+  start = performance.now();
+  for (let i = 0; i < ITERATIONS; i++) {
+    julia.untracked(() => {
+      julia.tagEval`let x = ${i}; x > 100 ? sqrt(x) : 2x end`;
+    });
+  }
+  report("2. Julia.tagEval`...${i}...`", performance.now() - start);
+
+  start = performance.now();
+  for (let i = 0; i < ITERATIONS; i++) {
+    julia.untracked(() => {
+      julia.eval("sum(abs2, 1:100)", { cache: true });
+    });
+  }
+  report("3. Julia.eval(code, { cache: true })", performance.now() - start);
+});
+
+Julia.close();
@@ -0,0 +1,117 @@
+/**
+ * Benchmark: cold start and time to first call
+ *
+ * Runs a fresh Bun process per sample. Each one times `Julia.init()` and then
+ * a first pass over common jlbun paths: eval, sharing and wrapping an array,
+ * a keyword call, a JS callback and a task. Results are compared for the
+ * default sysimage and for `build/sysimage.<ext>` built by `just sysimage`,
+ * when it exists.
+ *
+ * Usage: bun run benchmarks/init/cold-start.ts [samples]
+ */
+
+import { existsSync } from "fs";
+import { join } from "path";
+
+const CHILD_FLAG = "--child";
+
+if (process.argv.includes(CHILD_FLAG)) {
+  const { Julia, JuliaArray, JuliaFunction } = await import(
+    "../../jlbun/index.js"
+  );
+  const sysimage = process.env.JLBUN_BENCH_SYSIMAGE ?? "";
+  const bindir = process.env.JLBUN_BENCH_BINDIR ?? "";
+
+  let start = performance.now();
+  Julia.init({ sysimage, bindir });
+  const init = performance.now() - start;
+
+  start = performance.now();
+  await Julia.scopeAsync(async (julia) => {
+    const xs = JuliaArray.from(new Float64Array([3, 1, 2]));
+    julia.Base["sort!"].callWithKwargs({ rev: true }, xs);
+    julia.Base.sum(julia.eval("map(sqrt, 1:10)")).value;
+    const negate = JuliaFunction.from((x: number) => -x, {
+      returns: "f64",
+      args: ["f64"],
+    });
+    xs.map(negate).value;
+    negate.close();
+    await Julia.parallel.map(julia.Base.sqrt, xs);
+  });
+  const firstCall = performance.now() - start;
+
+  console.log(JSON.stringify({ init, firstCall }));
+  Julia.close();
+  process.exit(0);
+}
+
+const SAMPLES = Number(process.argv[2] ?? 5);
+
+const median = (xs: number[]) => {
+  const sorted = [...xs].sort((a, b) => a - b);
+  return sorted[Math.floor(sorted.length / 2)];
+};
+
+const run = (env: Record<string, string>) => {
+  const inits: number[] = [];
+  const firstCalls: number[] = [];
+  for (let i = 0; i < SAMPLES; i++) {
+    const proc = Bun.spawnSync(
+      [process.execPath, import.meta.path, CHILD_FLAG],
+      { env: { ...process.env, ...env } },
+    );
+    if (proc.exitCode !== 0) {
+      throw new Error(proc.stderr.toString());
+    }
+    const lines = proc.stdout.toString().trim().split("\n");
+    const { init, firstCall } = JSON.parse(lines[lines.length - 1]);
+    inits.push(init);
+    firstCalls.push(firstCall);
+  }
+  return { init: median(inits), firstCall: median(firstCalls) };
+};
+
+const bindir = Bun.spawnSync([
+  "julia",
+  "--startup-file=no",
+  "-e",
+  "print(Sys.BINDIR)",
+])
+  .stdout.toString()
+  .trim();
+const ext =
+  process.platform === "darwin"
+    ? "dylib"
+    : process.platform === "win32"
+      ? "dll"
+      : "so";
+const sysimage = join(import.meta.dir, "..", "..", "build", `sysimage.${ext}`);
+
+console.log("=".repeat(70));
+console.log("Cold Start Benchmark");
+console.log("=".repeat(70));
+console.log(`Samples per configuration: ${SAMPLES} (median reported)`);
+console.log();
+console.log(
+  `${"Sysimage".padEnd(20)} ${"Julia.init".padStart(14)} ${"First calls".padStart(14)} ${"Total".padStart(14)}`,
+);
+console.log("-".repeat(65));
+
+const configs: [string, Record<string, string>][] = [["default", {}]];
+if (existsSync(sysimage)) {
+  configs.push([
+    "build/sysimage",
+    { JLBUN_BENCH_SYSIMAGE: sysimage, JLBUN_BENCH_BINDIR: bindir },
+  ]);
+}
+for (const [name, env] of configs) {
+  const { init, firstCall } = run(env);
+  console.log(
+    `${name.padEnd(20)} ${`${init.toFixed(0)} ms`.padStart(14)} ${`${firstCall.toFixed(0)} ms`.padStart(14)} ${`${(init + firstCall).toFixed(0)} ms`.padStart(14)}`,
+  );
+}
+if (configs.length === 1) {
+  console.log();
+  console.log("No build/sysimage found; run `just sysimage` to compare.");
+}
@@ -0,0 +1,33 @@
+/**
+ * Compare two micro-benchmark reports, e.g. the JSON of the C suite
+ * (`jlbun_bench --json`) before and after upgrading Julia.
+ *
+ * Usage: bun run benchmarks/micro/diff.ts <baseline> <current> [options]
+ *   --threshold <pct>    regression threshold in percent (default 10)
+ *
+ * Exits with 1 when an operation got slower than the threshold.
+ */
+
+import { parseOptions, printDiff, readReport } from "./harness.js";
+
+const args = process.argv.slice(2);
+const [baselinePath, currentPath] = args.filter((arg, i) => {
+  return !arg.startsWith("--") && !args[i - 1]?.startsWith("--");
+});
+if (baselinePath === undefined || currentPath === undefined) {
+  console.error("Usage: diff.ts <baseline> <current> [--threshold <pct>]");
+  process.exit(2);
+}
+const threshold = Number(parseOptions(args).get("threshold") ?? 10);
+
+const regressions = printDiff(
+  readReport(baselinePath),
+  readReport(currentPath),
+  threshold,
+);
+if (regressions.length > 0) {
+  console.log(
+    `\n${regressions.length} operation(s) slower by more than ${threshold}%`,
+  );
+}
+process.exit(regressions.length > 0 ? 1 : 0);
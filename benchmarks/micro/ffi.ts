@@ -0,0 +1,405 @@
+/**
+ * Benchmark: jlbun's own per-operation cost at the FFI boundary
+ *
+ * Every case isolates one crossing or wrapper path, with no real work on
+ * either side: raw `jl_call0..3` vs `jl_call`, `Julia.call()`, `wrapPtr` by
+ * kind, box / unbox per primitive, `autoWrap`, scope enter / exit in each
+ * `ScopeMode`, `JuliaArray.from()` / `.value` by size, SubArray views and JS
+ * callback round trips.
+ *
+ * Usage: bun run benchmarks/micro/ffi.ts [options]
+ *   --filter <text>      only run cases whose group/name contains <text>
+ *   --json <file>        write the report as JSON
+ *   --baseline <file>    compare with a previous report; exits with 1 when
+ *                        an operation got slower than --threshold
+ *   --threshold <pct>    regression threshold in percent (default 10)
+ */
+
+import {
+  jlbun,
+  Julia,
+  JuliaArray,
+  JuliaFunction,
+  JuliaSubArray,
+  ScopeMode,
+} from "../../jlbun/index.js";
+import {
+  MicroCase,
+  MicroReport,
+  parseOptions,
+  printDiff,
+  printReport,
+  readReport,
+  runCase,
+  writeReport,
+} from "./harness.js";
+
+const options = parseOptions(process.argv.slice(2));
+const filter = options.get("filter") ?? "";
+const threshold = Number(options.get("threshold") ?? 10);
+
+Julia.init();
+
+// Raw symbols indexed by name, for the per-primitive box / unbox cases
+const symbols = jlbun.symbols as unknown as Record<
+  string,
+  (...args: unknown[]) => unknown
+>;
+
+const PRIMITIVES: [string, string, number | bigint][] = [
+  ["bool", "true", 1],
+  ["int8", "Int8(1)", 1],
+  ["uint8", "UInt8(1)", 1],
+  ["int16", "Int16(1)", 1],
+  ["uint16", "UInt16(1)", 1],
+  ["int32", "Int32(1)", 1],
+  ["uint32", "UInt32(1)", 1],
+  ["int64", "1000", 1000],
+  ["uint64", "UInt64(1000)", 1000n],
+  ["float32", "1.5f0", 1.5],
+  ["float64", "1.5", 1.5],
+];
+
+const WRAP_KINDS: [string, string][] = [
+  ["Int64", "1000"],
+  ["Float64", "1.5"],
+  ["String", '"hello"'],
+  ["Symbol", ":hello"],
+  ["Vector{Float64}", "rand(10)"],
+  ["Tuple", "(1, 2.0)"],
+  ["Dict", 'Dict("a" => 1)'],
+  ["SubArray", "view(rand(10), 2:5)"],
+  ["Function", "sin"],
+  ["Module", "Base"],
+];
+
+const AUTO_WRAP: [string, unknown][] = [
+  ["number (integer)", 1000],
+  ["number (float)", 1.5],
+  ["boolean", true],
+  ["bigint", 1000n],
+  ["string", "hello"],
+  ["array [1, 2, 3]", [1, 2, 3]],
+  ["object { a: 1 }", { a: 1 }],
+];
+
+const SCOPE_MODES: ScopeMode[] = ["default", "safe", "perf"];
+const ARRAY_SIZES = [1, 1_000, 1_000_000];
+
+const report: MicroReport = {
+  suite: "ffi",
+  julia: "",
+  runtime: `bun ${Bun.version}`,
+  date: new Date().toISOString(),
+  results: [],
+};
+
+Julia.scope((julia) => {
+  report.julia = Julia.version;
+  const cases: MicroCase[] = [];
+
+  // Calls: functions doing nothing, so only the crossing is measured
+  const f0 = julia.eval("() -> nothing").ptr;
+  const f1 = julia.eval("(a) -> a").ptr;
+  const f2 = julia.eval("(a, b) -> a").ptr;
+  const f3 = julia.eval("(a, b, c) -> a").ptr;
+  const x = julia.eval("1000").ptr;
+  const callArgs = new BigUint64Array([BigInt(x), BigInt(x), BigInt(x)]);
+  const identity = julia.eval("(a) -> a") as JuliaFunction;
+  cases.push(
+    {
+      group: "call",
+      name: "jl_call0",
+      iterations: 200_000,
+      run: (n) => {
+        for (let i = 0; i < n; i++) {
+          jlbun.symbols.jl_call0(f0);
+        }
+      },
+    },
+    {
+      group: "call",
+      name: "jl_call1",
+      iterations: 200_000,
+      run: (n) => {
+        for (let i = 0; i < n; i++) {
+          jlbun.symbols.jl_call1(f1, x);
+        }
+      },
+    },
+    {
+      group: "call",
+      name: "jl_call2",
+      iterations: 200_000,
+      run: (n) => {
+        for (let i = 0; i < n; i++) {
+          jlbun.symbols.jl_call2(f2, x, x);
+        }
+      },
+    },
+    {
+      group: "call",
+      name: "jl_call3",
+      iterations: 200_000,
+      run: (n) => {
+        for (let i = 0; i < n; i++) {
+          jlbun.symbols.jl_call3(f3, x, x, x);
+        }
+      },
+    },
+  );
+  for (const [nargs, f] of [f1, f2, f3].entries()) {
+    cases.push({
+      group: "call",
+      name: `jl_call with ${nargs + 1} arg(s)`,
+      iterations: 200_000,
+      run: (n) => {
+        for (let i = 0; i < n; i++) {
+          jlbun.symbols.jl_call(f, callArgs, nargs + 1);
+        }
+      },
+    });
+  }
+  cases.push(
+    {
+      group: "call",
+      name: "Julia.call(f, 1000)",
+      iterations: 100_000,
+      run: (n) =>
+        Julia.scope(() => {
+          for (let i = 0; i < n; i++) {
+            Julia.call(identity, 1000);
+          }
+        }),
+    },
+    {
+      group: "call",
+      name: "f(1000)",
+      iterations: 100_000,
+      run: (n) =>
+        Julia.scope(() => {
+          for (let i = 0; i < n; i++) {
+            identity(1000);
+          }
+        }),
+    },
+  );
+
+  // wrapPtr by kind, without scope rooting
+  for (const [kind, code] of WRAP_KINDS) {
+    const ptr = julia.eval(code).ptr;
+    cases.push({
+      group: "wrapPtr",
+      name: kind,
+      iterations: 200_000,
+      run: (n) => {
+        for (let i = 0; i < n; i++) {
+          Julia.unsafe.wrapPtr(ptr);
+        }
+      },
+    });
+  }
+
+  // Box / unbox per primitive through the raw symbols
+  for (const [type, code, value] of PRIMITIVES) {
+    const box = symbols[`jl_box_${type}`];
+    const unbox = symbols[`jl_unbox_${type}`];
+    const ptr = julia.eval(code).ptr;
+    cases.push(
+      {
+        group: "box",
+        name: `jl_box_${type}`,
+        iterations: 200_000,
+        run: (n) => {
+          for (let i = 0; i < n; i++) {
+            box(value);
+          }
+        },
+      },
+      {
+        group: "unbox",
+        name: `jl_unbox_${type}`,
+        iterations: 200_000,
+        run: (n) => {
+          for (let i = 0; i < n; i++) {
+            unbox(ptr);
+          }
+        },
+      },
+    );
+  }
+
+  for (const [name, value] of AUTO_WRAP) {
+    cases.push({
+      group: "autoWrap",
+      name,
+      iterations: 50_000,
+      run: (n) =>
+        Julia.scope(() => {
+          for (let i = 0; i < n; i++) {
+            Julia.autoWrap(value);
+          }
+        }),
+    });
+  }
+
+  for (const mode of SCOPE_MODES) {
+    cases.push(
+      {
+        group: "scope",
+        name: `${mode}: enter / exit`,
+        iterations: 100_000,
+        run: (n) => {
+          for (let i = 0; i < n; i++) {
+            Julia.scope(() => {}, { mode });
+          }
+        },
+      },
+      {
+        group: "scope",
+        name: `${mode}: enter / exit with 10 values`,
+        iterations: 10_000,
+        run: (n) => {
+          for (let i = 0; i < n; i++) {
+            Julia.scope(
+              () => {
+                for (let j = 0; j < 10; j++) {
+                  Julia.autoWrap(1000);
+                }
+              },
+              { mode },
+            );
+          }
+        },
+      },
+    );
+  }
+
+  for (const size of ARRAY_SIZES) {
+    const data = new Float64Array(size);
+    const array = JuliaArray.from(data);
+    cases.push(
+      {
+        group: "array",
+        name: `JuliaArray.from(Float64Array(${size}))`,
+        iterations: 20_000,
+        run: (n) =>
+          Julia.scope(() => {
+            for (let i = 0; i < n; i++) {
+              JuliaArray.from(data);
+            }
+          }),
+      },
+      {
+        group: "array",
+        name: `Vector{Float64}(${size}).value`,
+        iterations: 20_000,
+        run: (n) => {
+          for (let i = 0; i < n; i++) {
+            void array.value;
+          }
+        },
+      },
+    );
+  }
+
+  const parent = JuliaArray.from(new Float64Array(1000));
+  const makeView = julia.eval("a -> view(a, 2:999)") as JuliaFunction;
+  const view = makeView(parent) as JuliaSubArray;
+  cases.push(
+    {
+      group: "subarray",
+      name: "view(a, 2:999)",
+      iterations: 50_000,
+      run: (n) =>
+        Julia.scope(() => {
+          for (let i = 0; i < n; i++) {
+            makeView(parent);
+          }
+        }),
+    },
+    {
+      group: "subarray",
+      name: "layout",
+      iterations: 50_000,
+      run: (n) => {
+        for (let i = 0; i < n; i++) {
+          void view.layout;
+        }
+      },
+    },
+    {
+      group: "subarray",
+      name: "value (998 elements)",
+      iterations: 20_000,
+      run: (n) => {
+        for (let i = 0; i < n; i++) {
+          void view.value;
+        }
+      },
+    },
+  );
+
+  // JS -> Julia -> JS: Julia calls the callback once per crossing
+  const increment = JuliaFunction.from((v: number) => v + 1, {
+    returns: "f64",
+    args: ["f64"],
+  });
+  const callOnce = julia.eval("(cb, v) -> cb(v)") as JuliaFunction;
+  const mapCallback = julia.eval("(cb, xs) -> map(cb, xs)") as JuliaFunction;
+  const small = JuliaArray.from(new Float64Array(100));
+  cases.push(
+    {
+      group: "callback",
+      name: "round trip cb(1.5)",
+      iterations: 50_000,
+      run: (n) =>
+        Julia.scope(() => {
+          for (let i = 0; i < n; i++) {
+            callOnce(increment, 1.5);
+          }
+        }),
+    },
+    {
+      group: "callback",
+      name: "map(cb, xs) per element",
+      iterations: 100_000,
+      run: (n) =>
+        Julia.scope(() => {
+          for (let i = 0; i < n; i += 100) {
+            mapCallback(increment, small);
+          }
+        }),
+    },
+  );
+
+  for (const c of cases) {
+    if (`${c.group}/${c.name}`.includes(filter)) {
+      report.results.push(runCase(c));
+    }
+  }
+  increment.close();
+});
+
+printReport(report);
+
+const jsonPath = options.get("json");
+if (jsonPath) {
+  writeReport(jsonPath, report);
+  console.log(`\nWrote ${jsonPath}`);
+}
+
+const baselinePath = options.get("baseline");
+let regressions: string[] = [];
+if (baselinePath) {
+  console.log();
+  regressions = printDiff(readReport(baselinePath), report, threshold);
+  if (regressions.length > 0) {
+    console.log(
+      `\n${regressions.length} operation(s) slower by more than ${threshold}%`,
+    );
+  }
+}
+
+Julia.close();
+process.exit(regressions.length > 0 ? 1 : 0);
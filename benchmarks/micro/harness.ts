@@ -0,0 +1,167 @@
+/**
+ * Harness of the micro-benchmark suites.
+ *
+ * A case times one operation over a fixed number of iterations, in several
+ * rounds after a warm-up, and reports the median time per operation. A
+ * report is JSON shared with the C suite (`jlbun_bench --json`), so any two
+ * reports can be compared with `diffReports()` or `diff.ts`.
+ */
+
+import { readFileSync, writeFileSync } from "fs";
+
+export interface MicroCase {
+  group: string;
+  name: string;
+  iterations: number;
+  /** Runs `iterations` operations; called once per round. */
+  run: (iterations: number) => void;
+}
+
+export interface MicroResult {
+  group: string;
+  name: string;
+  iterations: number;
+  nsPerOp: number;
+}
+
+export interface MicroReport {
+  suite: string;
+  julia: string;
+  runtime: string;
+  date: string;
+  results: MicroResult[];
+}
+
+export interface MicroDiff {
+  key: string;
+  baseline: number | null;
+  current: number | null;
+  /** Relative change of the time per operation, in percent. */
+  change: number | null;
+}
+
+const ROUNDS = 7;
+
+const median = (xs: number[]) => {
+  const sorted = [...xs].sort((a, b) => a - b);
+  return sorted[Math.floor(sorted.length / 2)];
+};
+
+export function runCase(c: MicroCase): MicroResult {
+  // Warm up: compile the Julia methods and JIT the JS paths
+  c.run(Math.max(Math.floor(c.iterations / 10), 1));
+  const samples: number[] = [];
+  for (let round = 0; round < ROUNDS; round++) {
+    const start = Bun.nanoseconds();
+    c.run(c.iterations);
+    samples.push((Bun.nanoseconds() - start) / c.iterations);
+  }
+  return {
+    group: c.group,
+    name: c.name,
+    iterations: c.iterations,
+    nsPerOp: median(samples),
+  };
+}
+
+const resultKey = (r: MicroResult) => `${r.group}/${r.name}`;
+
+export function diffReports(
+  baseline: MicroReport,
+  current: MicroReport,
+): MicroDiff[] {
+  const before = new Map(baseline.results.map((r) => [resultKey(r), r]));
+  const diffs: MicroDiff[] = current.results.map((r) => {
+    const base = before.get(resultKey(r));
+    before.delete(resultKey(r));
+    return {
+      key: resultKey(r),
+      baseline: base?.nsPerOp ?? null,
+      current: r.nsPerOp,
+      change:
+        base === undefined
+          ? null
+          : ((r.nsPerOp - base.nsPerOp) / base.nsPerOp) * 100,
+    };
+  });
+  for (const [key, base] of before) {
+    diffs.push({ key, baseline: base.nsPerOp, current: null, change: null });
+  }
+  return diffs;
+}
+
+const formatNs = (ns: number | null) =>
+  ns === null
+    ? "-"
+    : ns < 1000
+      ? `${ns.toFixed(1)} ns`
+      : `${(ns / 1000).toFixed(2)} µs`;
+
+export function printReport(report: MicroReport): void {
+  console.log(`${report.suite} (${report.runtime}, Julia ${report.julia})`);
+  console.log("-".repeat(70));
+  let group = "";
+  for (const r of report.results) {
+    if (r.group !== group) {
+      group = r.group;
+      console.log(`[${group}]`);
+    }
+    console.log(
+      `  ${r.name.padEnd(48)} ${formatNs(r.nsPerOp).padStart(12)}`,
+    );
+  }
+}
+
+/**
+ * Print the changes from `baseline` to `current`. Returns the keys of the
+ * operations that got slower by more than `threshold` percent.
+ */
+export function printDiff(
+  baseline: MicroReport,
+  current: MicroReport,
+  threshold: number,
+): string[] {
+  const regressions: string[] = [];
+  console.log(
+    `${"Operation".padEnd(44)} ${"Baseline".padStart(10)} ${"Current".padStart(10)} ${"Change".padStart(8)}`,
+  );
+  console.log("-".repeat(75));
+  for (const d of diffReports(baseline, current)) {
+    const change =
+      d.change === null
+        ? "-"
+        : `${d.change > 0 ? "+" : ""}${d.change.toFixed(1)}%`;
+    const flag = d.change !== null && d.change > threshold ? "  !" : "";
+    if (flag) {
+      regressions.push(d.key);
+    }
+    console.log(
+      `${d.key.padEnd(44)} ${formatNs(d.baseline).padStart(10)} ${formatNs(d.current).padStart(10)} ${change.padStart(8)}${flag}`,
+    );
+  }
+  return regressions;
+}
+
+export const readReport = (path: string): MicroReport =>
+  JSON.parse(readFileSync(path, "utf8")) as MicroReport;
+
+export const writeReport = (path: string, report: MicroReport): void =>
+  writeFileSync(path, JSON.stringify(report, null, 2) + "\n");
+
+/**
+ * Parse `--name value` options; a flag without a value maps to `""`.
+ */
+export function parseOptions(argv: string[]): Map<string, string> {
+  const options = new Map<string, string>();
+  for (let i = 0; i < argv.length; i++) {
+    if (argv[i].startsWith("--")) {
+      const next = argv[i + 1];
+      const hasValue = next !== undefined && !next.startsWith("--");
+      options.set(argv[i].slice(2), hasValue ? next : "");
+      if (hasValue) {
+        i++;
+      }
+    }
+  }
+  return options;
+}
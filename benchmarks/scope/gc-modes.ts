@@ -7,7 +7,7 @@
  * 3. Perf mode - Lock-free stack-based, fastest (single-threaded LIFO only)
  *
  * Key differences:
- * - Default: Thread-safe mutex, scope isolation, O(n) release
+ * - Default: Thread-safe mutex, scope isolation, O(k) release of the scope's own slots
  * - Safe: All objects use FinalizationRegistry, closure-safe but non-deterministic
  * - Perf: No mutex, pure LIFO stack, O(1) release (single-threaded only!)
  */
@@ -0,0 +1,82 @@
+/**
+ * Benchmark: Scope release cost over a long-running process
+ *
+ * Runs millions of short default-mode scopes where a fraction of the values
+ * escape and stay alive for a while (like values captured by long-lived JS
+ * objects). Escaped values leave holes in the root stack when their scope
+ * ends; the scope release cost must stay flat as the process ages instead of
+ * growing with the number of scopes ever created or the holes left behind.
+ *
+ * Each row reports the mean cost of one scope (begin + pushes + end) over a
+ * window of scopes. A healthy run shows flat numbers across all windows.
+ */
+
+import { GCManager, Julia, JuliaArray } from "../../jlbun/index.js";
+
+Julia.init();
+
+const TOTAL_SCOPES = 2_000_000;
+const WINDOW = 200_000;
+const VALUES_PER_SCOPE = 4;
+const ESCAPE_EVERY = 8; // one scope in ESCAPE_EVERY escapes one value
+const ESCAPE_LIFETIME = 50_000; // escaped values are released this many scopes later
+
+// Helper to format numbers with commas
+const formatNum = (n: number) =>
+  n.toFixed(0).replace(/\B(?=(\d{3})+(?!\d))/g, ",");
+
+console.log("=".repeat(70));
+console.log("Scope Release Regression Benchmark");
+console.log("=".repeat(70));
+console.log(`Scopes: ${formatNum(TOTAL_SCOPES)}`);
+console.log(`Values per scope: ${VALUES_PER_SCOPE}`);
+console.log(`Escape rate: 1 / ${ESCAPE_EVERY} scopes`);
+console.log();
+
+Julia.scope((julia) => {
+  const arr = julia.Array.init(julia.Float64, 10) as JuliaArray;
+  const ptr = arr.ptr;
+
+  // Ring of escaped slots waiting to be released (simulated JS GC)
+  const escaped: number[] = [];
+  let escapedHead = 0;
+
+  console.log(
+    `${"Scopes".padStart(12)} ${"Per scope".padStart(12)} ${"Live roots".padStart(12)} ${"Capacity".padStart(12)}`,
+  );
+  console.log("-".repeat(52));
+
+  let windowStart = performance.now();
+  for (let i = 1; i <= TOTAL_SCOPES; i++) {
+    const scopeId = GCManager.scopeBegin();
+    let first = -1;
+    for (let j = 0; j < VALUES_PER_SCOPE; j++) {
+      const idx = GCManager.pushScopedPtr(ptr, scopeId);
+      if (j === 0) first = idx;
+    }
+    if (i % ESCAPE_EVERY === 0) {
+      GCManager.transfer(first, 0n);
+      escaped.push(first);
+    }
+    GCManager.scopeEnd(scopeId);
+
+    // Release escaped values once they are old enough
+    while (escaped.length - escapedHead > ESCAPE_LIFETIME / ESCAPE_EVERY) {
+      GCManager.release(escaped[escapedHead++]);
+    }
+
+    if (i % WINDOW === 0) {
+      const elapsed = performance.now() - windowStart;
+      console.log(
+        `${formatNum(i).padStart(12)} ${(((elapsed * 1000) / WINDOW).toFixed(3) + " µs").padStart(12)} ${formatNum(GCManager.size).padStart(12)} ${formatNum(GCManager.capacity).padStart(12)}`,
+      );
+      windowStart = performance.now();
+    }
+  }
+
+  while (escapedHead < escaped.length) {
+    GCManager.release(escaped[escapedHead++]);
+  }
+});
+
+Julia.close();
@@ -0,0 +1,103 @@
+/**
+ * Benchmark: Root storage contention under multi-threaded rooting
+ *
+ * Julia threads root and release values through the same C entry points used
+ * by `Julia.scope()`, each thread running its own stream of short scopes.
+ * Reports throughput and the per-shard lock counters from
+ * `GCManager.shardStats()`: with sharded root storage, threads working on
+ * different scopes rarely wait on the same lock.
+ *
+ * Run with several Julia threads, e.g.:
+ *   JULIA_NUM_THREADS=8 bun benchmarks/scope/sharded-roots.ts
+ */
+
+import { suffix } from "bun:ffi";
+import { join } from "path";
+import { GCManager, Julia, JuliaFunction } from "../../jlbun/index.js";
+
+Julia.init();
+
+const SCOPES_PER_THREAD = 200_000;
+const VALUES_PER_SCOPE = 4;
+const LIB_PATH = join(
+  import.meta.dir,
+  "..",
+  "..",
+  "build",
+  `libjlbun.${suffix}`,
+);
+
+// Helper to format numbers with commas
+const formatNum = (n: number) =>
+  n.toFixed(0).replace(/\B(?=(\d{3})+(?!\d))/g, ",");
+
+console.log("=".repeat(70));
+console.log("Sharded Root Storage Benchmark");
+console.log("=".repeat(70));
+console.log(`Julia threads: ${Julia.nthreads}`);
+console.log(`Shards: ${GCManager.shardCount}`);
+console.log(`Scopes per thread: ${formatNum(SCOPES_PER_THREAD)}`);
+console.log(`Values per scope: ${VALUES_PER_SCOPE}`);
+console.log();
+
+Julia.scope((julia) => {
+  const run = julia.eval(`
+    import Libdl
+    (lib, nscopes, nvalues) -> begin
+      h = Libdl.dlopen(lib)
+      scope_begin = Libdl.dlsym(h, :jlbun_gc_scope_begin)
+      push_scoped = Libdl.dlsym(h, :jlbun_gc_push_scoped)
+      scope_end = Libdl.dlsym(h, :jlbun_gc_scope_end)
+      Threads.@threads :static for t in 1:Threads.nthreads()
+        value = Ref(t)
+        for _ in 1:nscopes
+          s = ccall(scope_begin, UInt64, ())
+          for _ in 1:nvalues
+            ccall(push_scoped, Csize_t, (Any, UInt64), value, s)
+          end
+          ccall(scope_end, Cvoid, (UInt64,), s)
+        end
+      end
+      Threads.nthreads() * nscopes
+    end
+  `) as JuliaFunction;
+
+  // Warm up (compiles the threaded loop)
+  julia.call(run, LIB_PATH, 1000, VALUES_PER_SCOPE);
+
+  const before = GCManager.shardStats();
+  const start = performance.now();
+  const total = Number(
+    julia.call(run, LIB_PATH, SCOPES_PER_THREAD, VALUES_PER_SCOPE).value,
+  );
+  const elapsed = performance.now() - start;
+  const after = GCManager.shardStats();
+
+  console.log(`Total scopes: ${formatNum(total)}`);
+  console.log(`Total time: ${elapsed.toFixed(2)} ms`);
+  console.log(`Scopes/sec: ${formatNum(total / (elapsed / 1000))}`);
+  console.log();
+
+  console.log(
+    `${"Shard".padStart(6)} ${"Acquisitions".padStart(14)} ${"Contended".padStart(12)} ${"Rate".padStart(8)}`,
+  );
+  console.log("-".repeat(43));
+  let acquisitions = 0;
+  let contentions = 0;
+  after.forEach((s, i) => {
+    const acq = s.acquisitions - before[i].acquisitions;
+    const cont = s.contentions - before[i].contentions;
+    acquisitions += acq;
+    contentions += cont;
+    const rate = acq > 0 ? ((cont / acq) * 100).toFixed(2) + "%" : "-";
+    console.log(
+      `${String(i).padStart(6)} ${formatNum(acq).padStart(14)} ${formatNum(cont).padStart(12)} ${rate.padStart(8)}`,
+    );
+  });
+  console.log("-".repeat(43));
+  console.log(
+    `${"all".padStart(6)} ${formatNum(acquisitions).padStart(14)} ${formatNum(contentions).padStart(12)} ${(((contentions / Math.max(acquisitions, 1)) * 100).toFixed(2) + "%").padStart(8)}`,
+  );
+});
+
+Julia.close();
@@ -0,0 +1,81 @@
+/**
+ * Benchmark: Cost of wrapping a Julia value by kind
+ *
+ * Every call's return value goes through `Julia.wrapPtr`, which looks up a
+ * constructor by type pointer. The first value of each type is classified in
+ * C (`jlbun_classify_type`) and its constructor cached, so the steady state
+ * is one `jl_typeof` crossing plus a Map lookup for every kind, including
+ * parametric types such as `Dict{String, Int64}` or `SubArray`.
+ *
+ * Values are wrapped with `Julia.unsafe.wrapPtr` so the numbers exclude
+ * scope rooting.
+ */
+
+import { Julia, JuliaValue } from "../../jlbun/index.js";
+
+Julia.init();
+
+const ITERATIONS = 200_000;
+
+// Helper to format numbers with commas
+const formatNum = (n: number) =>
+  n.toFixed(0).replace(/\B(?=(\d{3})+(?!\d))/g, ",");
+
+const CASES: [string, string][] = [
+  ["Int64", "42"],
+  ["String", '"hello"'],
+  ["Symbol", ":hello"],
+  ["Vector{Float64}", "rand(10)"],
+  ["Matrix{Int32}", "zeros(Int32, 2, 2)"],
+  ["Tuple", "(1, 2.0)"],
+  ["NamedTuple", "(a = 1, b = 2)"],
+  ["Pair", "1 => 2"],
+  ["Dict", 'Dict("a" => 1)'],
+  ["IdDict", "IdDict(1 => 2)"],
+  ["Set", "Set([1, 2])"],
+  ["UnitRange", "1:10"],
+  ["StepRangeLen", "0.0:0.5:2.0"],
+  ["SubArray", "view(rand(10), 2:5)"],
+  ["ComplexF64", "1.0 + 2.0im"],
+  ["Function", "sin"],
+  ["Lambda", "x -> x + 1"],
+  ["DataType", "Float64"],
+  ["UnionAll", "Vector"],
+  ["Module", "Base"],
+  ["Other struct", "Some(1)"],
+];
+
+console.log("=".repeat(70));
+console.log("wrapPtr Cost by Kind");
+console.log("=".repeat(70));
+console.log(`Iterations per kind: ${formatNum(ITERATIONS)}`);
+console.log();
+console.log(
+  `${"Kind".padEnd(16)} ${"Wrapper".padEnd(16)} ${"Per wrap".padStart(12)} ${"Wraps/sec".padStart(14)}`,
+);
+console.log("-".repeat(61));
+
+Julia.scope((julia) => {
+  for (const [kind, code] of CASES) {
+    const value = julia.eval(code);
+    const ptr = value.ptr;
+
+    // Warm up (the first wrap classifies the type)
+    let wrapped: JuliaValue = value;
+    for (let i = 0; i < 1000; i++) {
+      wrapped = Julia.unsafe.wrapPtr(ptr);
+    }
+
+    const start = performance.now();
+    for (let i = 0; i < ITERATIONS; i++) {
+      wrapped = Julia.unsafe.wrapPtr(ptr);
+    }
+    const elapsed = performance.now() - start;
+
+    console.log(
+      `${kind.padEnd(16)} ${wrapped.constructor.name.padEnd(16)} ${(((elapsed * 1000) / ITERATIONS).toFixed(3) + " µs").padStart(12)} ${formatNum(ITERATIONS / (elapsed / 1000)).padStart(14)}`,
+    );
+  }
+});
+
+Julia.close();
@@ -0,0 +1,304 @@
+/**
+ * jlbun C micro-benchmarks
+ *
+ * Times the functions of c/wrapper.c (and the Julia C API calls they build
+ * on) without Bun in the loop, so that their cost can be told apart from
+ * the FFI boundary measured by benchmarks/micro/ffi.ts.
+ *
+ * Built with -DJLBUN_BUILD_BENCHMARKS=ON. Usage: jlbun_bench [--json]
+ * With --json the report is printed in the format of the Bun suite and can
+ * be compared with benchmarks/micro/diff.ts.
+ */
+
+#include <julia.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* ============================================================================
+ * c/wrapper.c Declarations
+ * ============================================================================
+ */
+
+jl_value_t *jl_function_getter(jl_module_t *m, const char *name);
+jl_datatype_t *jl_typeof_getter(jl_value_t *v);
+int32_t jlbun_classify_type(jl_datatype_t *t, jl_value_t **param);
+jl_value_t *jlbun_box_many(const uint8_t *kinds, const int64_t *payload,
+                           size_t n);
+int64_t jlbun_array_read(jl_array_t *a, size_t offset, size_t count,
+                         jl_datatype_t *type, void *out, uint8_t *valid);
+void jlbun_f16_to_f32(const uint16_t *src, float *dst, size_t n);
+void jlbun_gc_init(size_t initial_capacity);
+uint64_t jlbun_gc_scope_begin(void);
+size_t jlbun_gc_push_scoped(jl_value_t *v, uint64_t scope_id);
+size_t jlbun_gc_push_scoped_many(jl_value_t **ptrs, size_t n,
+                                 uint64_t scope_id, size_t *out_idx);
+size_t jlbun_gc_scope_end(uint64_t scope_id);
+void jlbun_gc_close(void);
+void jlbun_gc_perf_init(size_t initial_capacity);
+size_t jlbun_gc_perf_mark(void);
+size_t jlbun_gc_perf_push(jl_value_t *v);
+void jlbun_gc_perf_release(size_t mark);
+void jlbun_gc_perf_close(void);
+
+/* ============================================================================
+ * Harness
+ *
+ * Like benchmarks/micro/harness.ts: a warm-up of a tenth of the iterations,
+ * then the median time per operation over several rounds.
+ * ============================================================================
+ */
+
+#define BENCH_ROUNDS 7
+#define BENCH_BULK 100
+
+typedef struct {
+  const char *group;
+  const char *name;
+  size_t iterations;
+  void (*run)(size_t n);
+} BenchCase;
+
+static double now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static int compare_double(const void *a, const void *b) {
+  double x = *(const double *)a, y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+static double run_case(const BenchCase *c) {
+  double samples[BENCH_ROUNDS];
+  c->run(c->iterations / 10 > 0 ? c->iterations / 10 : 1);
+  for (int round = 0; round < BENCH_ROUNDS; round++) {
+    double start = now_ns();
+    c->run(c->iterations);
+    samples[round] = (now_ns() - start) / (double)c->iterations;
+  }
+  qsort(samples, BENCH_ROUNDS, sizeof(double), compare_double);
+  return samples[BENCH_ROUNDS / 2];
+}
+
+/* ============================================================================
+ * Cases
+ *
+ * Inputs are bound to globals in Main so that they stay rooted; results are
+ * dropped, as they are by the callers being measured.
+ * ============================================================================
+ */
+
+static jl_value_t *f0, *f1, *f2, *f3, *x;
+static jl_value_t *wrap_values[4];
+static jl_array_t *vec;
+static double read_buf[1000];
+static uint16_t half_buf[1024];
+static float single_buf[1024];
+static uint8_t box_kinds[16];
+static int64_t box_payload[16];
+
+static void bench_call0(size_t n) {
+  for (size_t i = 0; i < n; i++)
+    jl_call0(f0);
+}
+
+static void bench_call1(size_t n) {
+  for (size_t i = 0; i < n; i++)
+    jl_call1(f1, x);
+}
+
+static void bench_call2(size_t n) {
+  for (size_t i = 0; i < n; i++)
+    jl_call2(f2, x, x);
+}
+
+static void bench_call3(size_t n) {
+  for (size_t i = 0; i < n; i++)
+    jl_call3(f3, x, x, x);
+}
+
+static void bench_call_n3(size_t n) {
+  jl_value_t *args[3] = {x, x, x};
+  for (size_t i = 0; i < n; i++)
+    jl_call(f3, args, 3);
+}
+
+static void bench_function_getter(size_t n) {
+  for (size_t i = 0; i < n; i++)
+    jl_function_getter(jl_base_module, "sin");
+}
+
+static void bench_classify(size_t n) {
+  jl_value_t *param;
+  for (size_t i = 0; i < n; i++)
+    jlbun_classify_type(jl_typeof_getter(wrap_values[i % 4]), &param);
+}
+
+static void bench_box_int64(size_t n) {
+  for (size_t i = 0; i < n; i++)
+    jl_box_int64((int64_t)i + 1024);
+}
+
+static void bench_box_float64(size_t n) {
+  for (size_t i = 0; i < n; i++)
+    jl_box_float64((double)i);
+}
+
+static void bench_unbox_float64(size_t n) {
+  jl_value_t *v = wrap_values[1];
+  volatile double sink = 0;
+  for (size_t i = 0; i < n; i++)
+    sink += jl_unbox_float64(v);
+  (void)sink;
+}
+
+// Per value: 16 primitives boxed into a Vector{Any}
+static void bench_box_many(size_t n) {
+  for (size_t i = 0; i < n; i += 16)
+    jlbun_box_many(box_kinds, box_payload, 16);
+}
+
+// Per value: a scope rooting 10 values, one push each
+static void bench_scope_push(size_t n) {
+  for (size_t i = 0; i < n; i += 10) {
+    uint64_t scope = jlbun_gc_scope_begin();
+    for (int j = 0; j < 10; j++)
+      jlbun_gc_push_scoped(x, scope);
+    jlbun_gc_scope_end(scope);
+  }
+}
+
+// Per value: a scope rooting BENCH_BULK values with one bulk push
+static void bench_scope_push_many(size_t n) {
+  jl_value_t *ptrs[BENCH_BULK];
+  size_t idx[BENCH_BULK];
+  for (int j = 0; j < BENCH_BULK; j++)
+    ptrs[j] = x;
+  for (size_t i = 0; i < n; i += BENCH_BULK) {
+    uint64_t scope = jlbun_gc_scope_begin();
+    jlbun_gc_push_scoped_many(ptrs, BENCH_BULK, scope, idx);
+    jlbun_gc_scope_end(scope);
+  }
+}
+
+// Per value: a perf-mode scope rooting 10 values
+static void bench_perf_push(size_t n) {
+  for (size_t i = 0; i < n; i += 10) {
+    size_t mark = jlbun_gc_perf_mark();
+    for (int j = 0; j < 10; j++)
+      jlbun_gc_perf_push(x);
+    jlbun_gc_perf_release(mark);
+  }
+}
+
+static void bench_array_read(size_t n) {
+  for (size_t i = 0; i < n; i++)
+    jlbun_array_read(vec, 0, 1000, jl_float64_type, read_buf, NULL);
+}
+
+static void bench_f16_to_f32(size_t n) {
+  for (size_t i = 0; i < n; i++)
+    jlbun_f16_to_f32(half_buf, single_buf, 1024);
+}
+
+static const BenchCase CASES[] = {
+    {"call", "jl_call0", 1000000, bench_call0},
+    {"call", "jl_call1", 1000000, bench_call1},
+    {"call", "jl_call2", 1000000, bench_call2},
+    {"call", "jl_call3", 1000000, bench_call3},
+    {"call", "jl_call with 3 arg(s)", 1000000, bench_call_n3},
+    {"call", "jl_function_getter(Base, sin)", 1000000, bench_function_getter},
+    {"wrapPtr", "jl_typeof + jlbun_classify_type", 1000000, bench_classify},
+    {"box", "jl_box_int64", 1000000, bench_box_int64},
+    {"box", "jl_box_float64", 1000000, bench_box_float64},
+    {"box", "jlbun_box_many per value", 1000000, bench_box_many},
+    {"unbox", "jl_unbox_float64", 1000000, bench_unbox_float64},
+    {"scope", "default: push per value", 1000000, bench_scope_push},
+    {"scope", "default: bulk push per value", 1000000, bench_scope_push_many},
+    {"scope", "perf: push per value", 1000000, bench_perf_push},
+    {"array", "jlbun_array_read(Float64, 1000)", 100000, bench_array_read},
+    {"array", "jlbun_f16_to_f32(1024)", 100000, bench_f16_to_f32},
+};
+
+#define NCASES (sizeof(CASES) / sizeof(CASES[0]))
+
+static jl_value_t *bench_global(const char *code) {
+  jl_value_t *v = jl_eval_string(code);
+  if (jl_exception_occurred()) {
+    fprintf(stderr, "Failed to evaluate %s\n", code);
+    exit(1);
+  }
+  return v;
+}
+
+static void setup(void) {
+  f0 = bench_global("const __jlbun_bench_f0__ = () -> nothing");
+  f1 = bench_global("const __jlbun_bench_f1__ = (a) -> a");
+  f2 = bench_global("const __jlbun_bench_f2__ = (a, b) -> a");
+  f3 = bench_global("const __jlbun_bench_f3__ = (a, b, c) -> a");
+  x = bench_global("const __jlbun_bench_x__ = 1000");
+  wrap_values[0] = x;
+  wrap_values[1] = bench_global("const __jlbun_bench_f64__ = 1.5");
+  wrap_values[2] = bench_global("const __jlbun_bench_v__ = rand(1000)");
+  wrap_values[3] = bench_global("const __jlbun_bench_d__ = Dict(1 => 2)");
+  vec = (jl_array_t *)wrap_values[2];
+  for (int i = 0; i < 16; i++) {
+    // Alternate Int64 and Float64 payloads, like jlbun_box_many's callers
+    box_kinds[i] = (uint8_t)(i % 2);
+    box_payload[i] = i % 2 == 0 ? i : 0x3ff8000000000000; // 1.5
+  }
+  jlbun_gc_init(1024);
+  jlbun_gc_perf_init(1024);
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================
+ */
+
+int main(int argc, char **argv) {
+  int json = argc > 1 && strcmp(argv[1], "--json") == 0;
+
+  jl_init();
+  setup();
+
+  char date[32];
+  time_t t = time(NULL);
+  strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", gmtime(&t));
+
+  if (json)
+    printf("{\n  \"suite\": \"c\",\n  \"julia\": \"%s\",\n"
+           "  \"runtime\": \"c\",\n  \"date\": \"%s\",\n  \"results\": [\n",
+           jl_ver_string(), date);
+  else
+    printf("c (Julia %s)\n%s\n", jl_ver_string(),
+           "----------------------------------------------------------------"
+           "------");
+
+  const char *group = "";
+  for (size_t i = 0; i < NCASES; i++) {
+    const BenchCase *c = &CASES[i];
+    double ns = run_case(c);
+    if (json) {
+      printf("    {\"group\": \"%s\", \"name\": \"%s\", \"iterations\": %zu, "
+             "\"nsPerOp\": %.3f}%s\n",
+             c->group, c->name, c->iterations, ns, i + 1 < NCASES ? "," : "");
+    } else {
+      if (strcmp(c->group, group) != 0) {
+        group = c->group;
+        printf("[%s]\n", group);
+      }
+      printf("  %-48s %9.1f ns\n", c->name, ns);
+    }
+  }
+  if (json)
+    printf("  ]\n}\n");
+
+  jlbun_gc_perf_close();
+  jlbun_gc_close();
+  jl_atexit_hook(0);
+  return 0;
+}
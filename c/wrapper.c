@@ -6,8 +6,17 @@
  */
 
 #include <julia.h>
+#include <stdlib.h>
 #include <string.h>
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define JLBUN_HAVE_F16C 1
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define JLBUN_HAVE_NEON_F16 1
+#endif
+
 /* ============================================================================
  * Version Compatibility Macros
  * ============================================================================
@@ -46,6 +55,16 @@ void jl_init_with_image0(const char *julia_home_dir,
 #endif
 }
 
+// Write a `precompile(...)` statement for every method compiled from now on
+// to `path`, like `--trace-compile`. Call before jl_init to capture
+// everything compiled during the session.
+void jlbun_set_trace_compile(const char *path) {
+  static char *trace_path = NULL;
+  free(trace_path);
+  trace_path = strdup(path);
+  jl_options.trace_compile = trace_path;
+}
+
 /* ============================================================================
  * Data Type Getters
  *
@@ -122,6 +141,134 @@ jl_value_t *jl_nothing_getter(void) { return jl_nothing; }
 jl_value_t *jl_true_getter(void) { return jl_true; }
 jl_value_t *jl_false_getter(void) { return jl_false; }
 
+// Type name of the (possibly parametric) type `Base.<name>`, or NULL
+static jl_typename_t *base_typename(const char *name) {
+  jl_value_t *t = jl_get_global(jl_base_module, jl_symbol(name));
+  if (t == NULL)
+    return NULL;
+  t = jl_unwrap_unionall(t);
+  return jl_is_datatype(t) ? ((jl_datatype_t *)t)->name : NULL;
+}
+
+/* ============================================================================
+ * Type Classification
+ *
+ * Map a concrete type to the kind of JS wrapper it needs, by comparing its
+ * type name pointer against a small table instead of matching type strings.
+ * The JS side caches the resulting constructor per type pointer, so each
+ * type is classified once.
+ * ============================================================================
+ */
+
+// Must match the wrapper kinds in jlbun/julia.ts
+#define JLBUN_KIND_ANY 0
+#define JLBUN_KIND_FUNCTION 1
+#define JLBUN_KIND_SYMBOL 2
+#define JLBUN_KIND_MODULE 3
+#define JLBUN_KIND_TYPE 4
+#define JLBUN_KIND_ARRAY 5
+#define JLBUN_KIND_TUPLE 6
+#define JLBUN_KIND_PAIR 7
+#define JLBUN_KIND_NAMEDTUPLE 8
+#define JLBUN_KIND_PTR 9
+#define JLBUN_KIND_SET 10
+#define JLBUN_KIND_DICT 11
+#define JLBUN_KIND_IDDICT 12
+#define JLBUN_KIND_RANGE 13
+#define JLBUN_KIND_SUBARRAY 14
+#define JLBUN_KIND_COMPLEX 15
+
+#define JLBUN_KIND_TABLE_SIZE 14
+
+static struct {
+  jl_typename_t *name;
+  int32_t kind;
+} kind_table[JLBUN_KIND_TABLE_SIZE];
+static int kind_table_ready = 0;
+
+static void kind_table_init(void) {
+  static const struct {
+    const char *name;
+    int32_t kind;
+  } base_kinds[] = {
+      {"Pair", JLBUN_KIND_PAIR},
+      {"Set", JLBUN_KIND_SET},
+      {"Dict", JLBUN_KIND_DICT},
+      {"IdDict", JLBUN_KIND_IDDICT},
+      {"UnitRange", JLBUN_KIND_RANGE},
+      {"StepRange", JLBUN_KIND_RANGE},
+      {"StepRangeLen", JLBUN_KIND_RANGE},
+      {"LinRange", JLBUN_KIND_RANGE},
+      {"SubArray", JLBUN_KIND_SUBARRAY},
+      {"Complex", JLBUN_KIND_COMPLEX},
+  };
+  int n = 0;
+  kind_table[n].name = jl_array_typename;
+  kind_table[n++].kind = JLBUN_KIND_ARRAY;
+  kind_table[n].name = jl_tuple_typename;
+  kind_table[n++].kind = JLBUN_KIND_TUPLE;
+  kind_table[n].name = jl_namedtuple_typename;
+  kind_table[n++].kind = JLBUN_KIND_NAMEDTUPLE;
+  kind_table[n].name = jl_pointer_typename;
+  kind_table[n++].kind = JLBUN_KIND_PTR;
+  for (size_t i = 0; i < sizeof(base_kinds) / sizeof(base_kinds[0]); i++) {
+    kind_table[n].name = base_typename(base_kinds[i].name);
+    kind_table[n++].kind = base_kinds[i].kind;
+  }
+  kind_table_ready = 1;
+}
+
+// Classify the type `t` of a value into a JLBUN_KIND_* constant. For
+// arrays, SubArrays and complex numbers `*param` is set to the element type
+// (complex numbers with other than Float64/32/16 parts are JLBUN_KIND_ANY);
+// otherwise it is NULL.
+int32_t jlbun_classify_type(jl_datatype_t *t, jl_value_t **param) {
+  *param = NULL;
+  if (!kind_table_ready)
+    kind_table_init();
+
+  if (t == jl_symbol_type)
+    return JLBUN_KIND_SYMBOL;
+  if (jl_subtype((jl_value_t *)t, (jl_value_t *)jl_function_type))
+    return JLBUN_KIND_FUNCTION;
+  if (t == jl_module_type)
+    return JLBUN_KIND_MODULE;
+  if (t == jl_datatype_type || t == jl_unionall_type)
+    return JLBUN_KIND_TYPE;
+  if (!jl_is_datatype(t))
+    return JLBUN_KIND_ANY;
+
+  int32_t kind = JLBUN_KIND_ANY;
+  for (int i = 0; i < JLBUN_KIND_TABLE_SIZE; i++) {
+    if (kind_table[i].name == t->name) {
+      kind = kind_table[i].kind;
+      break;
+    }
+  }
+
+  switch (kind) {
+  case JLBUN_KIND_ARRAY:
+  case JLBUN_KIND_SUBARRAY:
+    *param = jl_tparam0(t);
+    break;
+  case JLBUN_KIND_COMPLEX: {
+    jl_value_t *p = jl_tparam0(t);
+    if (p != (jl_value_t *)jl_float64_type &&
+        p != (jl_value_t *)jl_float32_type &&
+        p != (jl_value_t *)jl_float16_type)
+      return JLBUN_KIND_ANY;
+    *param = p;
+    break;
+  }
+  case JLBUN_KIND_ANY:
+    // Callable objects of anonymous types, e.g. `#1#2`
+    if (jl_symbol_name(t->name->name)[0] == '#')
+      kind = JLBUN_KIND_FUNCTION;
+    break;
+  }
+  return kind;
+}
+
 /* ============================================================================
  * Float16 Boxing/Unboxing
  *
@@ -493,10 +640,56 @@ void jl_array_ptr_set_wrapper(jl_array_t *a, size_t i, jl_value_t *v) {
  * Array Operations - Multi-dimensional Allocation
  *
  * Compatibility wrapper for jl_alloc_array_nd which doesn't exist in
- * Julia 1.10.
+ * Julia 1.10, and zero-copy N-D wrapping of external buffers.
  * ============================================================================
  */
 
+// Build an NTuple{n, Int} from `values` (or 1, ..., n when `values` is NULL),
+// optionally in reverse order
+static jl_value_t *int_tuple_new(const size_t *values, size_t n, int reverse) {
+  jl_value_t **boxed;
+  JL_GC_PUSHARGS(boxed, n);
+  for (size_t i = 0; i < n; i++) {
+    size_t j = reverse ? n - 1 - i : i;
+    boxed[i] = jl_box_long((long)(values != NULL ? values[j] : j + 1));
+  }
+  JL_FUNCTION_TYPE *tuple_func = jl_get_function(jl_core_module, "tuple");
+  jl_value_t *tuple = jl_call(tuple_func, boxed, (uint32_t)n);
+  JL_GC_POP();
+  return tuple;
+}
+
+// Wrap `data` as an N-D array of type `atype` (Array{T, ndims}) without
+// copying. `dims` is the column-major shape. With `row_major` set, `dims` is
+// the row-major shape instead: the buffer is wrapped with the reversed shape
+// and returned as a PermutedDimsArray view, which has shape `dims` and shares
+// the buffer. Returns NULL if Julia threw.
+jl_value_t *jlbun_ptr_to_array_nd(jl_value_t *atype, void *data,
+                                  const size_t *dims, size_t ndims,
+                                  int own_buffer, int row_major) {
+  jl_value_t *dims_tuple = NULL;
+  jl_value_t *array = NULL;
+  jl_value_t *perm = NULL;
+  JL_GC_PUSH4(&atype, &dims_tuple, &array, &perm);
+
+  dims_tuple = int_tuple_new(dims, ndims, row_major);
+  if (dims_tuple == NULL) {
+    JL_GC_POP();
+    return NULL;
+  }
+  array = (jl_value_t *)jl_ptr_to_array(atype, data, dims_tuple, own_buffer);
+  if (row_major && ndims > 1) {
+    // PermutedDimsArray(array, (N, ..., 1))
+    perm = int_tuple_new(NULL, ndims, 1);
+    JL_FUNCTION_TYPE *permuted =
+        jl_get_function(jl_base_module, "PermutedDimsArray");
+    array = perm != NULL ? jl_call2(permuted, array, perm) : NULL;
+  }
+
+  JL_GC_POP();
+  return array;
+}
+
 #if JL_VERSION_AT_LEAST(1, 11)
 
 jl_array_t *jl_alloc_array_nd_wrapper(jl_value_t *atype, size_t *dims,
@@ -510,22 +703,270 @@ jl_array_t *jl_alloc_array_nd_wrapper(jl_value_t *atype, size_t *dims,
                                       size_t ndims) {
   jl_value_t *dims_tuple = NULL;
   JL_GC_PUSH2(&atype, &dims_tuple);
-
-  jl_value_t **values;
-  JL_GC_PUSHARGS(values, ndims);
-  for (size_t i = 0; i < ndims; i++) {
-    values[i] = jl_box_long((long)dims[i]);
-  }
-  jl_function_t *tuple_func = jl_get_function(jl_core_module, "tuple");
-  dims_tuple = jl_call(tuple_func, values, (uint32_t)ndims);
+  dims_tuple = int_tuple_new(dims, ndims, 0);
   jl_array_t *array = jl_new_array(atype, dims_tuple);
   JL_GC_POP();
-  JL_GC_POP();
   return array;
 }
 
 #endif
 
+/* ============================================================================
+ * Array Operations - Strided Views
+ *
+ * Describes a dense array, or a SubArray of one indexed by integers and
+ * (stepped) integer ranges, as a strided block of memory:
+ *
+ *   element (i_1, ..., i_n) = data[sum_k (i_k - 1) * strides[k]]
+ *
+ * The layout is computed from the parent's dims and the SubArray's indices
+ * without calling into Julia, so the JS side can wrap contiguous views as a
+ * TypedArray and copy other views with jlbun_strided_gather().
+ * ============================================================================
+ */
+
+#define JLBUN_STRIDED_MAX_DIMS 16
+
+typedef struct {
+  void *data;     // Address of the first element
+  int64_t elsize; // Element size in bytes
+  int64_t ndims;
+  int64_t shape[JLBUN_STRIDED_MAX_DIMS];
+  int64_t strides[JLBUN_STRIDED_MAX_DIMS]; // In elements, may be negative
+} JlbunStridedLayout;
+
+_Static_assert(sizeof(JlbunStridedLayout) ==
+                   (3 + 2 * JLBUN_STRIDED_MAX_DIMS) * sizeof(int64_t),
+               "JlbunStridedLayout must be a flat array of 64-bit words");
+
+static jl_typename_t *subarray_typename = NULL;
+static jl_typename_t *unitrange_typename = NULL;
+static jl_typename_t *steprange_typename = NULL;
+static jl_typename_t *oneto_typename = NULL;
+static jl_typename_t *slice_typename = NULL;
+
+// Locate field i of an object of type `*dt` stored at `*data`, following
+// pointer fields. Fails on undefined fields and inline unions.
+static int strided_field(const char **data, jl_datatype_t **dt, size_t i) {
+  jl_datatype_t *t = *dt;
+  if (i >= jl_datatype_nfields(t))
+    return 0;
+  const char *p = *data + jl_field_offset(t, i);
+  if (jl_field_isptr(t, i)) {
+    jl_value_t *f = *(jl_value_t *const *)p;
+    if (f == NULL)
+      return 0;
+    *data = (const char *)f;
+    *dt = (jl_datatype_t *)jl_typeof(f);
+    return 1;
+  }
+  jl_value_t *ft = jl_field_type(t, i);
+  if (!jl_is_datatype(ft))
+    return 0;
+  *data = p;
+  *dt = (jl_datatype_t *)ft;
+  return 1;
+}
+
+// Read field i as an Int64
+static int strided_int(const char *data, jl_datatype_t *dt, size_t i,
+                       int64_t *out) {
+  if (!strided_field(&data, &dt, i) || dt != jl_int64_type)
+    return 0;
+  memcpy(out, data, sizeof(int64_t));
+  return 1;
+}
+
+// Read an index as first element, step and length. Returns 0 for index
+// types that do not select a strided set (e.g. vectors of indices), and -1
+// for a scalar index, which drops the dimension.
+static int strided_index(const char *data, jl_datatype_t *dt, int64_t *first,
+                         int64_t *step, int64_t *len) {
+  if (dt == jl_int64_type) {
+    memcpy(first, data, sizeof(int64_t));
+    return -1;
+  }
+
+  // Base.Slice wraps the axis of a colon index
+  if (dt->name == slice_typename) {
+    if (!strided_field(&data, &dt, 0) || dt->name == slice_typename)
+      return 0;
+    return strided_index(data, dt, first, step, len);
+  }
+
+  int64_t last;
+  *step = 1;
+  if (dt->name == oneto_typename) {
+    *first = 1;
+    if (!strided_int(data, dt, 0, &last))
+      return 0;
+  } else if (dt->name == unitrange_typename) {
+    if (!strided_int(data, dt, 0, first) || !strided_int(data, dt, 1, &last))
+      return 0;
+  } else if (dt->name == steprange_typename) {
+    if (!strided_int(data, dt, 0, first) || !strided_int(data, dt, 1, step) ||
+        !strided_int(data, dt, 2, &last) || *step == 0)
+      return 0;
+  } else {
+    return 0;
+  }
+
+  // Julia normalizes `last` so that it is hit exactly by the steps
+  if (*step > 0 ? last < *first : last > *first)
+    *len = 0;
+  else
+    *len = (last - *first) / *step + 1;
+  return 1;
+}
+
+static int strided_layout(jl_value_t *v, JlbunStridedLayout *out, int depth) {
+  if (jl_is_array(v)) {
+    jl_array_t *a = (jl_array_t *)v;
+    jl_value_t *eltype = jl_array_eltype(v);
+    if (jl_array_isboxed(a) || !jl_is_datatype(eltype) ||
+        !jl_isbits(eltype))
+      return 0;
+    int ndims = jl_array_ndims(a);
+    if (ndims > JLBUN_STRIDED_MAX_DIMS)
+      return 0;
+
+    out->data = JL_ARRAY_DATA(a);
+    out->elsize = (int64_t)jl_datatype_size(eltype);
+    out->ndims = ndims;
+    int64_t stride = 1;
+    for (int k = 0; k < ndims; k++) {
+      out->shape[k] = (int64_t)jl_array_dim(a, k);
+      out->strides[k] = stride;
+      stride *= out->shape[k];
+    }
+    return 1;
+  }
+
+  // Views of views: apply the indices to the parent's layout
+  jl_datatype_t *dt = (jl_datatype_t *)jl_typeof(v);
+  if (dt->name != subarray_typename || depth > 8)
+    return 0;
+
+  const char *parent_data = (const char *)v;
+  jl_datatype_t *parent_type = dt;
+  if (!strided_field(&parent_data, &parent_type, 0) ||
+      !strided_layout((jl_value_t *)parent_data, out, depth + 1))
+    return 0;
+
+  const char *indices = (const char *)v;
+  jl_datatype_t *indices_type = dt;
+  if (!strided_field(&indices, &indices_type, 1) ||
+      jl_datatype_nfields(indices_type) != (size_t)out->ndims)
+    return 0;
+
+  int64_t offset = 0;
+  int64_t ndims = 0;
+  for (int64_t k = 0; k < out->ndims; k++) {
+    const char *index = indices;
+    jl_datatype_t *index_type = indices_type;
+    int64_t first, step, len;
+    if (!strided_field(&index, &index_type, (size_t)k))
+      return 0;
+    int kind = strided_index(index, index_type, &first, &step, &len);
+    if (kind == 0)
+      return 0;
+    offset += (first - 1) * out->strides[k];
+    if (kind > 0) {
+      // Dimensions only move down, so they can be compacted in place
+      out->shape[ndims] = len;
+      out->strides[ndims] = step * out->strides[k];
+      ndims++;
+    }
+  }
+
+  out->data = (char *)out->data + offset * out->elsize;
+  out->ndims = ndims;
+  return 1;
+}
+
+// Describe `v` as a strided block of isbits elements. Returns 1 and fills
+// `out` for dense arrays and SubArrays of them indexed by integers, colons
+// and integer ranges; returns 0 otherwise. The layout is only valid while
+// the parent array is alive and not resized.
+int jlbun_strided_layout(jl_value_t *v, JlbunStridedLayout *out) {
+  if (subarray_typename == NULL) {
+    unitrange_typename = base_typename("UnitRange");
+    steprange_typename = base_typename("StepRange");
+    oneto_typename = base_typename("OneTo");
+    slice_typename = base_typename("Slice");
+    subarray_typename = base_typename("SubArray");
+  }
+  memset(out, 0, sizeof(*out));
+  return strided_layout(v, out, 0);
+}
+
+// Copy the elements of a strided layout into `out` in column-major order.
+// Returns the number of elements copied, or -1 if `out_len` elements are
+// not enough. Never allocates.
+int64_t jlbun_strided_gather(const JlbunStridedLayout *layout, void *out,
+                             size_t out_len) {
+  int64_t ndims = layout->ndims;
+  int64_t total = 1;
+  for (int64_t k = 0; k < ndims; k++)
+    total *= layout->shape[k];
+  if ((size_t)total > out_len)
+    return -1;
+  if (total == 0)
+    return 0;
+
+  size_t elsize = (size_t)layout->elsize;
+  // A 0-D view is a single element
+  int64_t n0 = ndims > 0 ? layout->shape[0] : 1;
+  int64_t s0 = ndims > 0 ? layout->strides[0] : 1;
+  int64_t counter[JLBUN_STRIDED_MAX_DIMS] = {0};
+  const char *src = (const char *)layout->data;
+  char *dst = (char *)out;
+
+  for (;;) {
+    // Innermost dimension: specialized copies for the common element sizes
+    switch (elsize) {
+    case 1:
+      for (int64_t i = 0; i < n0; i++)
+        dst[i] = src[i * s0];
+      break;
+    case 2:
+      for (int64_t i = 0; i < n0; i++)
+        memcpy(dst + 2 * i, src + 2 * i * s0, 2);
+      break;
+    case 4:
+      for (int64_t i = 0; i < n0; i++)
+        memcpy(dst + 4 * i, src + 4 * i * s0, 4);
+      break;
+    case 8:
+      for (int64_t i = 0; i < n0; i++)
+        memcpy(dst + 8 * i, src + 8 * i * s0, 8);
+      break;
+    default:
+      if (s0 == 1) {
+        memcpy(dst, src, (size_t)n0 * elsize);
+      } else {
+        for (int64_t i = 0; i < n0; i++)
+          memcpy(dst + i * elsize, src + i * s0 * (int64_t)elsize, elsize);
+      }
+      break;
+    }
+    dst += (size_t)n0 * elsize;
+
+    // Advance the outer dimensions like an odometer
+    int64_t k = 1;
+    for (; k < ndims; k++) {
+      src += layout->strides[k] * (int64_t)elsize;
+      if (++counter[k] < layout->shape[k])
+        break;
+      src -= layout->strides[k] * layout->shape[k] * (int64_t)elsize;
+      counter[k] = 0;
+    }
+    if (k >= ndims)
+      break;
+  }
+  return total;
+}
+
 /* ============================================================================
  * Pointer Operations
  * ============================================================================
@@ -598,40 +1039,49 @@ jl_value_t *jl_ptr_load(jl_value_t *ptr_value, size_t offset) {
   return jl_new_bits(eltype, target);
 }
 
-// Helper: convert float to Float16 bits
+// Helper: convert float to Float16 bits, rounding to nearest even as
+// Julia's Float16(x) and the F16C instructions do
 static uint16_t float_to_float16(float value) {
   uint32_t f32_bits;
   memcpy(&f32_bits, &value, sizeof(f32_bits));
 
-  uint32_t sign = (f32_bits >> 31) & 0x1;
-  int32_t exp = ((f32_bits >> 23) & 0xff) - 127 + 15;
-  uint32_t frac = f32_bits & 0x7fffff;
+  uint16_t sign = (f32_bits >> 16) & 0x8000;
+  uint32_t abs = f32_bits & 0x7fffffff;
 
   // Handle special cases
-  if (((f32_bits >> 23) & 0xff) == 0xff) {
-    // Infinity or NaN
-    if (frac == 0) {
-      return (sign << 15) | 0x7c00; // Infinity
-    } else {
-      return (sign << 15) | 0x7c00 | (frac >> 13); // NaN
+  if (abs >= 0x7f800000) {
+    if (abs == 0x7f800000) {
+      return sign | 0x7c00; // Infinity
     }
+    return sign | 0x7e00 | ((abs >> 13) & 0x3ff); // Quiet NaN
   }
 
-  if (exp >= 31) {
-    // Overflow to infinity
-    return (sign << 15) | 0x7c00;
-  } else if (exp <= 0) {
-    // Underflow to zero or denormal
-    if (exp < -10) {
-      return sign << 15;
+  if (abs >= 0x477ff000) {
+    // At least halfway between floatmax(Float16) and 2^16: infinity
+    return sign | 0x7c00;
+  } else if (abs < 0x38800000) {
+    // Below 2^-14: denormal or zero
+    if (abs < 0x33000000) {
+      return sign; // Below half the smallest denormal
     }
-    // Denormalized
-    uint32_t m = frac | 0x800000;
-    int shift = 14 - exp;
-    return (sign << 15) | (m >> shift);
+    uint32_t m = (abs & 0x7fffff) | 0x800000;
+    uint32_t shift = 126 - (abs >> 23);
+    uint32_t h = m >> shift;
+    uint32_t rem = m & ((1u << shift) - 1);
+    uint32_t half = 1u << (shift - 1);
+    if (rem > half || (rem == half && (h & 1))) {
+      h++;
+    }
+    return sign | h;
   } else {
-    // Normalized
-    return (sign << 15) | (exp << 10) | (frac >> 13);
+    // Normalized: rebias the exponent, round the 13 dropped bits. A carry
+    // out of the fraction correctly bumps the exponent.
+    uint32_t h = (abs - 0x38000000) >> 13;
+    uint32_t rem = abs & 0x1fff;
+    if (rem > 0x1000 || (rem == 0x1000 && (h & 1))) {
+      h++;
+    }
+    return sign | h;
   }
 }
 
@@ -657,8 +1107,10 @@ static float float16_to_float(uint16_t bits) {
       f32_bits = (sign << 31) | ((exp + 127 - 15) << 23) | (frac << 13);
     }
   } else if (exp == 31) {
-    // Infinity or NaN
+    // Infinity or NaN (quieted, as F16C does)
     f32_bits = (sign << 31) | 0x7f800000 | (frac << 13);
+    if (frac != 0)
+      f32_bits |= 0x400000;
   } else {
     // Normalized
     f32_bits = (sign << 31) | ((exp + 127 - 15) << 23) | (frac << 13);
@@ -825,320 +1277,1744 @@ jl_value_t *jl_ptr_add(jl_value_t *ptr_value, int64_t n) {
 }
 
 /* ============================================================================
- * Scope-based GC Root Management
- *
- * Provides FFI-friendly GC rooting with scope isolation for concurrent async
- * operations. Each scope has a unique ID, allowing independent release without
- * affecting other scopes.
- *
- * Design:
- *   - Scope-based: each value belongs to a scope_id
- *   - Thread-safe: protected by mutex
- *   - Concurrent-safe: scopes can be released in any order
- *   - Efficient: O(1) push, O(n) release (only touches scope's values)
- *
- * API:
- *   - jlbun_gc_scope_begin(): Start a new scope, returns scope_id
- *   - jlbun_gc_push_scoped(v, scope_id): Push value to specific scope
- *   - jlbun_gc_scope_end(scope_id): Release all values in scope
- *   - jlbun_gc_transfer(idx, new_scope_id): Move value to another scope
- * (escape)
- *   - jlbun_gc_get_scope(idx): Get scope_id of value at index
- *   - jlbun_gc_release(idx): Release one temporary slot
+ * Float16 Bulk Conversion
  *
- * Global scope (id=0):
- *   - Values in scope_id=0 are never auto-released
- *   - Use for escaped values that should persist until JS GC runs
+ * Convert whole buffers between IEEE 754 half and single precision. On
+ * x86-64 CPUs with F16C the conversion runs 8 lanes at a time and on
+ * AArch64 4 lanes at a time with NEON; elsewhere, and for the tail, the
+ * scalar helpers above are used. Narrowing rounds to nearest even on every
+ * path, so results do not depend on the CPU.
  * ============================================================================
  */
 
-#include <pthread.h>
-#include <stdlib.h>
-
-typedef struct {
-  jl_array_t *values;     // Vector{Any} as root storage
-  uint64_t *scope_ids;    // C array: scope ownership for each slot
-  size_t top;             // Current stack top (next write position)
-  size_t capacity;        // Current capacity
-  uint64_t next_scope_id; // Counter for generating unique scope IDs
-  pthread_mutex_t lock;   // Thread safety
-  int initialized;        // Initialization flag
-} JlbunGCStack;
+typedef void (*f16_to_f32_fn)(const uint16_t *, float *, size_t);
+typedef void (*f32_to_f16_fn)(const float *, uint16_t *, size_t);
 
-static JlbunGCStack gc_stack = {NULL, NULL, 0, 0, 1, PTHREAD_MUTEX_INITIALIZER,
-                                0};
+static void f16_to_f32_scalar(const uint16_t *src, float *dst, size_t n) {
+  for (size_t i = 0; i < n; i++)
+    dst[i] = float16_to_float(src[i]);
+}
 
-// Initialize the GC root stack
-void jlbun_gc_init(size_t initial_capacity) {
-  pthread_mutex_lock(&gc_stack.lock);
+static void f32_to_f16_scalar(const float *src, uint16_t *dst, size_t n) {
+  for (size_t i = 0; i < n; i++)
+    dst[i] = float_to_float16(src[i]);
+}
 
-  if (gc_stack.initialized) {
-    pthread_mutex_unlock(&gc_stack.lock);
-    return; // Already initialized
+#if defined(JLBUN_HAVE_F16C)
+__attribute__((target("avx,f16c"))) static void
+f16_to_f32_f16c(const uint16_t *src, float *dst, size_t n) {
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m128i h = _mm_loadu_si128((const __m128i *)(src + i));
+    _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
   }
+  f16_to_f32_scalar(src + i, dst + i, n - i);
+}
 
-  // Allocate Vector{Any} for values
-  jl_value_t *any_type = (jl_value_t *)jl_any_type;
-  jl_value_t *array_type = jl_apply_array_type(any_type, 1);
-  gc_stack.values = jl_alloc_array_1d(array_type, initial_capacity);
-
-  // Allocate C array for scope IDs
-  gc_stack.scope_ids = (uint64_t *)calloc(initial_capacity, sizeof(uint64_t));
-  if (!gc_stack.scope_ids) {
-    pthread_mutex_unlock(&gc_stack.lock);
-    return; // Allocation failed
+__attribute__((target("avx,f16c"))) static void
+f32_to_f16_f16c(const float *src, uint16_t *dst, size_t n) {
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(src + i),
+                                _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    _mm_storeu_si128((__m128i *)(dst + i), h);
   }
+  f32_to_f16_scalar(src + i, dst + i, n - i);
+}
+#elif defined(JLBUN_HAVE_NEON_F16)
+static void f16_to_f32_neon(const uint16_t *src, float *dst, size_t n) {
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    float16x4_t h = vreinterpret_f16_u16(vld1_u16(src + i));
+    vst1q_f32(dst + i, vcvt_f32_f16(h));
+  }
+  f16_to_f32_scalar(src + i, dst + i, n - i);
+}
 
-  gc_stack.capacity = initial_capacity;
-  gc_stack.top = 0;
-  gc_stack.next_scope_id = 1; // 0 is reserved for global/legacy
-
-  // Julia 1.12+ requires declaring global before assignment
-  // Use eval to declare and assign in one step
-  char eval_buf[256];
-  snprintf(eval_buf, sizeof(eval_buf),
-           "global __jlbun_gc_stack__::Vector{Any} = Vector{Any}(nothing, %zu)",
-           initial_capacity);
-  jl_eval_string(eval_buf);
-
-  // Get the array we just created and use it as our values storage
-  jl_value_t *values =
-      jl_get_global(jl_main_module, jl_symbol("__jlbun_gc_stack__"));
-  if (values != NULL && jl_is_array(values)) {
-    gc_stack.values = (jl_array_t *)values;
+static void f32_to_f16_neon(const float *src, uint16_t *dst, size_t n) {
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    float16x4_t h = vcvt_f16_f32(vld1q_f32(src + i));
+    vst1_u16(dst + i, vreinterpret_u16_f16(h));
   }
-
-  gc_stack.initialized = 1;
-  pthread_mutex_unlock(&gc_stack.lock);
+  f32_to_f16_scalar(src + i, dst + i, n - i);
 }
+#endif
 
-// Ensure capacity (internal helper, must be called with lock held)
-static int ensure_capacity_locked(size_t needed) {
-  if (needed <= gc_stack.capacity)
-    return 1;
+// Kernels for this CPU, selected on first use. Concurrent first calls
+// store the same pointers, so no lock is needed.
+static f16_to_f32_fn f16_to_f32_kernel = NULL;
+static f32_to_f16_fn f32_to_f16_kernel = NULL;
+
+static void f16_kernels_init(void) {
+  f16_to_f32_fn widen = f16_to_f32_scalar;
+  f32_to_f16_fn narrow = f32_to_f16_scalar;
+#if defined(JLBUN_HAVE_F16C)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c")) {
+    widen = f16_to_f32_f16c;
+    narrow = f32_to_f16_f16c;
+  }
+#elif defined(JLBUN_HAVE_NEON_F16)
+  widen = f16_to_f32_neon;
+  narrow = f32_to_f16_neon;
+#endif
+  f32_to_f16_kernel = narrow;
+  f16_to_f32_kernel = widen;
+}
 
-  // Double capacity until sufficient
-  size_t old_cap = gc_stack.capacity;
-  size_t new_cap = gc_stack.capacity;
-  if (new_cap == 0)
-    new_cap = 1;
-  while (new_cap < needed)
-    new_cap *= 2;
+// Widen n Float16 values (as raw bits) to Float32
+void jlbun_f16_to_f32(const uint16_t *src, float *dst, size_t n) {
+  if (f16_to_f32_kernel == NULL)
+    f16_kernels_init();
+  f16_to_f32_kernel(src, dst, n);
+}
 
-  uint64_t *new_scope_ids =
-      (uint64_t *)malloc(new_cap * sizeof(uint64_t));
-  if (new_scope_ids == NULL) {
-    return 0;
-  }
-  if (old_cap > 0) {
-    memcpy(new_scope_ids, gc_stack.scope_ids, old_cap * sizeof(uint64_t));
-  }
-  memset(new_scope_ids + old_cap, 0, (new_cap - old_cap) * sizeof(uint64_t));
+// Narrow n Float32 values to Float16 bits, rounding to nearest even
+void jlbun_f32_to_f16(const float *src, uint16_t *dst, size_t n) {
+  if (f32_to_f16_kernel == NULL)
+    f16_kernels_init();
+  f32_to_f16_kernel(src, dst, n);
+}
 
-  // Grow Julia Vector{Any} via resize!
-  JL_FUNCTION_TYPE *resize_fn = jl_get_function(jl_base_module, "resize!");
-  jl_value_t *new_cap_value = jl_box_int64(new_cap);
-  JL_GC_PUSH1(&new_cap_value);
-  jl_call2(resize_fn, (jl_value_t *)gc_stack.values, new_cap_value);
-  if (jl_exception_occurred() != NULL) {
-    JL_GC_POP();
-    free(new_scope_ids);
-    return 0;
-  }
-  JL_GC_POP();
+// Whether the F16C or NEON kernels are in use
+int32_t jlbun_f16_simd(void) {
+  if (f16_to_f32_kernel == NULL)
+    f16_kernels_init();
+  return f16_to_f32_kernel != f16_to_f32_scalar;
+}
 
-  // Fill new value slots with nothing
-  for (size_t i = old_cap; i < new_cap; i++) {
-    jl_array_ptr_set(gc_stack.values, i, jl_nothing);
-  }
+/* ============================================================================
+ * Array Operations - Bulk Typed Access
+ *
+ * Copy a range of array elements to or from a dense buffer of one numeric
+ * bits type in a single call. Dense arrays of the same type are copied with
+ * memcpy and other numeric element types are converted; boxed arrays
+ * (Vector{Any}, ...) and isbits-union arrays (Union{Missing, T}, ...) are
+ * unboxed or boxed element by element according to their type tags.
+ *
+ * Missing elements (`missing`, `nothing` or undefined) are reported through
+ * an optional validity bitmap with one bit per element, least significant
+ * bit first, as in Apache Arrow.
+ * ============================================================================
+ */
 
-  free(gc_stack.scope_ids);
-  gc_stack.scope_ids = new_scope_ids;
-  gc_stack.capacity = new_cap;
-  return 1;
-}
+#define JLBUN_BITS_SIGNED 1
+#define JLBUN_BITS_UNSIGNED 2
+#define JLBUN_BITS_FLOAT 3
 
-// Begin a new scope, returns unique scope_id
-uint64_t jlbun_gc_scope_begin(void) {
-  pthread_mutex_lock(&gc_stack.lock);
+static jl_datatype_t *missing_type = NULL;
 
-  if (!gc_stack.initialized) {
-    pthread_mutex_unlock(&gc_stack.lock);
-    return 0; // Error: not initialized, return invalid scope_id
-  }
+static jl_datatype_t *get_missing_type(void) {
+  if (missing_type == NULL)
+    missing_type = (jl_datatype_t *)jl_get_global(jl_base_module,
+                                                  jl_symbol("Missing"));
+  return missing_type;
+}
 
-  uint64_t scope_id = gc_stack.next_scope_id++;
-  pthread_mutex_unlock(&gc_stack.lock);
-  return scope_id;
+// Classify a numeric bits type. Returns 0 for other types.
+static int bits_class(jl_datatype_t *t) {
+  if (t == jl_float64_type || t == jl_float32_type || t == jl_float16_type)
+    return JLBUN_BITS_FLOAT;
+  if (t == jl_int64_type || t == jl_int32_type || t == jl_int16_type ||
+      t == jl_int8_type)
+    return JLBUN_BITS_SIGNED;
+  if (t == jl_uint64_type || t == jl_uint32_type || t == jl_uint16_type ||
+      t == jl_uint8_type || t == jl_bool_type)
+    return JLBUN_BITS_UNSIGNED;
+  return 0;
 }
 
-// Push a value with explicit scope_id, returns index
-size_t jlbun_gc_push_scoped(jl_value_t *v, uint64_t scope_id) {
-  pthread_mutex_lock(&gc_stack.lock);
+STATIC_INLINE int is_missing_type(jl_value_t *t) {
+  return t == (jl_value_t *)get_missing_type() ||
+         t == (jl_value_t *)jl_nothing_type;
+}
 
-  if (!gc_stack.initialized) {
-    pthread_mutex_unlock(&gc_stack.lock);
-    return SIZE_MAX; // Error: not initialized
+// Sign-extend a signed integer of `size` bytes
+static int64_t bits_read_signed(const void *src, size_t size) {
+  switch (size) {
+  case 1:
+    return *(const int8_t *)src;
+  case 2: {
+    int16_t x;
+    memcpy(&x, src, sizeof(x));
+    return x;
+  }
+  case 4: {
+    int32_t x;
+    memcpy(&x, src, sizeof(x));
+    return x;
+  }
+  default: {
+    int64_t x;
+    memcpy(&x, src, sizeof(x));
+    return x;
   }
-
-  JL_GC_PUSH1(&v);
-  if (!ensure_capacity_locked(gc_stack.top + 1)) {
-    JL_GC_POP();
-    pthread_mutex_unlock(&gc_stack.lock);
-    return SIZE_MAX;
   }
-  size_t idx = gc_stack.top++;
-  jl_array_ptr_set(gc_stack.values, idx, v);
-  gc_stack.scope_ids[idx] = scope_id;
-  JL_GC_POP();
-
-  pthread_mutex_unlock(&gc_stack.lock);
-  return idx;
 }
 
-// End a scope: release all values belonging to this scope_id
-void jlbun_gc_scope_end(uint64_t scope_id) {
-  pthread_mutex_lock(&gc_stack.lock);
+// Zero-extend an unsigned integer of `size` bytes (little-endian)
+static uint64_t bits_read_unsigned(const void *src, size_t size) {
+  uint64_t x = 0;
+  memcpy(&x, src, size);
+  return x;
+}
 
-  if (!gc_stack.initialized || scope_id == 0) {
-    pthread_mutex_unlock(&gc_stack.lock);
-    return; // scope_id=0 is global, never auto-released
+// Convert one value between numeric bits types. Integers are truncated to
+// narrower integer types, as when assigning to a JS TypedArray; floats are
+// never converted to integers. Returns 0 if the conversion is not allowed.
+static int bits_convert(jl_datatype_t *from, const void *src,
+                        jl_datatype_t *to, void *dst) {
+  if (from == to) {
+    memcpy(dst, src, jl_datatype_size(to));
+    return 1;
   }
+  int from_class = bits_class(from);
+  int to_class = bits_class(to);
+  if (from_class == 0 || to_class == 0)
+    return 0;
 
-  // Clear all slots belonging to this scope
-  for (size_t i = 0; i < gc_stack.top; i++) {
-    if (gc_stack.scope_ids[i] == scope_id) {
-      jl_array_ptr_set(gc_stack.values, i, jl_nothing);
-      gc_stack.scope_ids[i] = 0; // Mark as free
+  if (to_class == JLBUN_BITS_FLOAT) {
+    double d;
+    if (from == jl_float64_type) {
+      memcpy(&d, src, sizeof(double));
+    } else if (from == jl_float32_type) {
+      float f;
+      memcpy(&f, src, sizeof(float));
+      d = f;
+    } else if (from == jl_float16_type) {
+      uint16_t h;
+      memcpy(&h, src, sizeof(uint16_t));
+      d = float16_to_float(h);
+    } else if (from_class == JLBUN_BITS_SIGNED) {
+      d = (double)bits_read_signed(src, jl_datatype_size(from));
+    } else {
+      d = (double)bits_read_unsigned(src, jl_datatype_size(from));
+    }
+    if (to == jl_float64_type) {
+      memcpy(dst, &d, sizeof(double));
+    } else if (to == jl_float32_type) {
+      float f = (float)d;
+      memcpy(dst, &f, sizeof(float));
+    } else {
+      uint16_t h = float_to_float16((float)d);
+      memcpy(dst, &h, sizeof(uint16_t));
     }
+    return 1;
   }
 
-  // Shrink top if trailing slots are empty
-  while (gc_stack.top > 0 && gc_stack.scope_ids[gc_stack.top - 1] == 0 &&
-         jl_array_ptr_ref(gc_stack.values, gc_stack.top - 1) == jl_nothing) {
-    gc_stack.top--;
-  }
+  if (from_class == JLBUN_BITS_FLOAT)
+    return 0;
 
-  pthread_mutex_unlock(&gc_stack.lock);
+  // Extend to 64 bits, then keep the low bytes
+  uint64_t bits = from_class == JLBUN_BITS_SIGNED
+                      ? (uint64_t)bits_read_signed(src, jl_datatype_size(from))
+                      : bits_read_unsigned(src, jl_datatype_size(from));
+  if (to == jl_bool_type)
+    bits = bits != 0;
+  memcpy(dst, &bits, jl_datatype_size(to));
+  return 1;
 }
 
-// Transfer a value to a different scope (for escape)
-// Returns new index, or SIZE_MAX on error
-size_t jlbun_gc_transfer(size_t idx, uint64_t new_scope_id) {
-  pthread_mutex_lock(&gc_stack.lock);
-
-  if (!gc_stack.initialized || idx >= gc_stack.top) {
-    pthread_mutex_unlock(&gc_stack.lock);
-    return SIZE_MAX;
+// Convert a dense Float16 <-> Float32 run with the bulk kernels. Returns 0
+// for other pairs of types.
+static int dense_convert_f16(jl_datatype_t *from, const void *src,
+                             jl_datatype_t *to, void *dst, size_t count) {
+  if (from == jl_float16_type && to == jl_float32_type) {
+    jlbun_f16_to_f32((const uint16_t *)src, (float *)dst, count);
+    return 1;
   }
+  if (from == jl_float32_type && to == jl_float16_type) {
+    jlbun_f32_to_f16((const float *)src, (uint16_t *)dst, count);
+    return 1;
+  }
+  return 0;
+}
 
-  gc_stack.scope_ids[idx] = new_scope_id;
-
-  pthread_mutex_unlock(&gc_stack.lock);
-  return idx;
+STATIC_INLINE void validity_set(uint8_t *valid, size_t i) {
+  valid[i >> 3] |= (uint8_t)(1u << (i & 7));
 }
 
-// Get the scope_id of a value at index
-uint64_t jlbun_gc_get_scope(size_t idx) {
-  pthread_mutex_lock(&gc_stack.lock);
+STATIC_INLINE int validity_get(const uint8_t *valid, size_t i) {
+  return valid == NULL || ((valid[i >> 3] >> (i & 7)) & 1);
+}
 
-  if (!gc_stack.initialized || idx >= gc_stack.top) {
-    pthread_mutex_unlock(&gc_stack.lock);
+// Storage of an isbits-union array: element data, selector bytes and
+// element size. Returns 0 for other arrays.
+static int union_array_storage(jl_array_t *a, char **data, uint8_t **tags,
+                               size_t *elsize) {
+#if JL_VERSION_AT_LEAST(1, 11)
+  jl_genericmemory_t *m = a->ref.mem;
+  const jl_datatype_layout_t *layout =
+      ((jl_datatype_t *)jl_typetagof(m))->layout;
+  if (!layout->flags.arrayelem_isunion)
     return 0;
-  }
-
-  uint64_t scope_id = gc_stack.scope_ids[idx];
-  pthread_mutex_unlock(&gc_stack.lock);
-  return scope_id;
+  // For union arrays the reference holds an element offset, not a pointer
+  size_t offset = (size_t)a->ref.ptr_or_offset;
+  *elsize = layout->size;
+  *data = (char *)m->ptr + offset * layout->size;
+  *tags = (uint8_t *)jl_genericmemory_typetagdata(m) + offset;
+#else
+  if (!jl_array_isbitsunion(a))
+    return 0;
+  *elsize = a->elsize;
+  *data = (char *)jl_array_data(a);
+  *tags = (uint8_t *)jl_array_typetagdata(a);
+#endif
+  return 1;
 }
 
-// Get value at index (for debugging/escape)
-// Thread-safe: protects against concurrent modifications
-jl_value_t *jlbun_gc_get(size_t idx) {
-  pthread_mutex_lock(&gc_stack.lock);
+// Read elements a[offset], ..., a[offset + count - 1] (0-based linear
+// indices) into `out` as values of the numeric bits type `type`. Missing
+// elements are written as zero and cleared in `valid` (ceil(count / 8)
+// bytes); without a bitmap they are an error. Returns `count`, or -(i + 1)
+// if element i could not be converted. The caller checks the bounds.
+int64_t jlbun_array_read(jl_array_t *a, size_t offset, size_t count,
+                         jl_datatype_t *type, void *out, uint8_t *valid) {
+  size_t size = jl_datatype_size(type);
+  char *dst = (char *)out;
+  if (valid != NULL)
+    memset(valid, 0, (count + 7) / 8);
 
-  if (!gc_stack.initialized || idx >= gc_stack.top) {
-    pthread_mutex_unlock(&gc_stack.lock);
-    return jl_nothing;
+  if (jl_array_isboxed(a)) {
+    for (size_t i = 0; i < count; i++, dst += size) {
+      jl_value_t *v = jl_array_ptr_ref(a, offset + i);
+      if (v == NULL || is_missing_type(jl_typeof(v))) {
+        if (valid == NULL)
+          return -(int64_t)(i + 1);
+        memset(dst, 0, size);
+        continue;
+      }
+      if (!bits_convert((jl_datatype_t *)jl_typeof(v), jl_data_ptr(v), type,
+                        dst))
+        return -(int64_t)(i + 1);
+      if (valid != NULL)
+        validity_set(valid, i);
+    }
+    return (int64_t)count;
   }
 
-  jl_value_t *val = jl_array_ptr_ref(gc_stack.values, idx);
-  pthread_mutex_unlock(&gc_stack.lock);
-  return val;
+  jl_value_t *eltype = jl_array_eltype((jl_value_t *)a);
+  char *data;
+  uint8_t *tags;
+  size_t elsize;
+  if (union_array_storage(a, &data, &tags, &elsize)) {
+    // Selector byte -> union component, looked up once per selector
+    jl_value_t *components[256] = {NULL};
+    data += offset * elsize;
+    tags += offset;
+    for (size_t i = 0; i < count; i++, dst += size) {
+      uint8_t tag = tags[i];
+      if (components[tag] == NULL)
+        components[tag] = jl_nth_union_component(eltype, tag);
+      jl_value_t *component = components[tag];
+      if (component == NULL || is_missing_type(component)) {
+        if (valid == NULL)
+          return -(int64_t)(i + 1);
+        memset(dst, 0, size);
+        continue;
+      }
+      if (!bits_convert((jl_datatype_t *)component, data + i * elsize, type,
+                        dst))
+        return -(int64_t)(i + 1);
+      if (valid != NULL)
+        validity_set(valid, i);
+    }
+    return (int64_t)count;
+  }
+
+  // Dense array of one bits type
+  jl_datatype_t *from = (jl_datatype_t *)eltype;
+  elsize = jl_datatype_size(from);
+  const char *src = (const char *)JL_ARRAY_DATA(a) + offset * elsize;
+  if (from == type) {
+    memcpy(dst, src, count * size);
+  } else if (!dense_convert_f16(from, src, type, dst, count)) {
+    for (size_t i = 0; i < count; i++) {
+      if (!bits_convert(from, src + i * elsize, type, dst + i * size))
+        return -(int64_t)(i + 1);
+    }
+  }
+  if (valid != NULL)
+    memset(valid, 0xff, (count + 7) / 8);
+  return (int64_t)count;
 }
 
-// Set value at index (for escape - move value to specific slot)
-void jlbun_gc_set(size_t idx, jl_value_t *v) {
-  pthread_mutex_lock(&gc_stack.lock);
+// Write elements, storing the instance of `missing` (Missing or Nothing)
+// for invalid ones. See jlbun_array_write.
+static int64_t array_write(jl_array_t *a, size_t offset, size_t count,
+                           jl_datatype_t *type, const void *src,
+                           const uint8_t *valid, jl_datatype_t *missing) {
+  size_t size = jl_datatype_size(type);
+  const char *from = (const char *)src;
+  jl_value_t *eltype = jl_array_eltype((jl_value_t *)a);
 
-  if (!gc_stack.initialized || idx >= gc_stack.capacity) {
-    pthread_mutex_unlock(&gc_stack.lock);
+  if (jl_array_isboxed(a)) {
+    int can_store = jl_subtype((jl_value_t *)type, eltype);
+    int can_miss = jl_subtype((jl_value_t *)missing, eltype);
+    jl_value_t *v = NULL;
+    JL_GC_PUSH2(&a, &v);
+    for (size_t i = 0; i < count; i++, from += size) {
+      if (!validity_get(valid, i)) {
+        if (!can_miss) {
+          JL_GC_POP();
+          return -(int64_t)(i + 1);
+        }
+        jl_array_ptr_set(a, offset + i, missing->instance);
+        continue;
+      }
+      if (!can_store) {
+        JL_GC_POP();
+        return -(int64_t)(i + 1);
+      }
+      v = jl_new_bits((jl_value_t *)type, from);
+      jl_array_ptr_set(a, offset + i, v);
+    }
+    JL_GC_POP();
+    return (int64_t)count;
+  }
+
+  char *data;
+  uint8_t *tags;
+  size_t elsize;
+  if (union_array_storage(a, &data, &tags, &elsize)) {
+    // Store into `type` itself if it is a member, else into the only
+    // numeric member
+    int value_tag = -1;
+    int numeric_tag = -1;
+    int numeric_count = 0;
+    int missing_tag = -1;
+    int n = jl_count_union_components(eltype);
+    for (int j = 0; j < n && j < 256; j++) {
+      jl_value_t *component = jl_nth_union_component(eltype, j);
+      if (component == (jl_value_t *)missing) {
+        missing_tag = j;
+      } else if (component == (jl_value_t *)type) {
+        value_tag = j;
+      } else if (jl_is_datatype(component) &&
+                 bits_class((jl_datatype_t *)component)) {
+        numeric_tag = j;
+        numeric_count++;
+      }
+    }
+    if (value_tag < 0 && numeric_count == 1)
+      value_tag = numeric_tag;
+    jl_datatype_t *to =
+        value_tag >= 0
+            ? (jl_datatype_t *)jl_nth_union_component(eltype, value_tag)
+            : NULL;
+
+    data += offset * elsize;
+    tags += offset;
+    for (size_t i = 0; i < count; i++, from += size) {
+      if (!validity_get(valid, i)) {
+        if (missing_tag < 0)
+          return -(int64_t)(i + 1);
+        tags[i] = (uint8_t)missing_tag;
+        continue;
+      }
+      if (to == NULL || !bits_convert(type, from, to, data + i * elsize))
+        return -(int64_t)(i + 1);
+      tags[i] = (uint8_t)value_tag;
+    }
+    return (int64_t)count;
+  }
+
+  // Dense array of one bits type: every element must be present
+  jl_datatype_t *to = (jl_datatype_t *)eltype;
+  elsize = jl_datatype_size(to);
+  char *dst = (char *)JL_ARRAY_DATA(a) + offset * elsize;
+  for (size_t i = 0; i < count; i++) {
+    if (!validity_get(valid, i))
+      return -(int64_t)(i + 1);
+  }
+  if (to == type) {
+    memcpy(dst, from, count * size);
+    return (int64_t)count;
+  }
+  if (dense_convert_f16(type, from, to, dst, count))
+    return (int64_t)count;
+  for (size_t i = 0; i < count; i++) {
+    if (!bits_convert(type, from + i * size, to, dst + i * elsize))
+      return -(int64_t)(i + 1);
+  }
+  return (int64_t)count;
+}
+
+// Write `count` values of the numeric bits type `type` from `src` into
+// a[offset], ..., a[offset + count - 1]. Elements whose bit is cleared in
+// `valid` are written as `missing`, which the element type must allow.
+// Boxed arrays get freshly boxed values of type `type`; isbits arrays and
+// isbits-union arrays convert to their (non-missing) element type. Returns
+// `count`, or -(i + 1) if element i could not be stored; elements before i
+// have been written. The caller checks the bounds.
+int64_t jlbun_array_write(jl_array_t *a, size_t offset, size_t count,
+                          jl_datatype_t *type, const void *src,
+                          const uint8_t *valid) {
+  return array_write(a, offset, count, type, src, valid, get_missing_type());
+}
+
+// Offset i of a packed string buffer with 4- or 8-byte offsets
+STATIC_INLINE int64_t packed_offset(const void *offsets, int32_t width,
+                                    size_t i) {
+  return width == 4 ? ((const int32_t *)offsets)[i]
+                    : ((const int64_t *)offsets)[i];
+}
+
+// Store n strings split from `bytes` by `offsets` into the boxed vector a,
+// or `nothing` where a bit of `valid` is cleared.
+static void strings_fill(jl_array_t *a, const char *bytes,
+                         const void *offsets, int32_t width,
+                         const uint8_t *valid, size_t n) {
+  jl_value_t *v = NULL;
+  JL_GC_PUSH2(&a, &v);
+  for (size_t i = 0; i < n; i++) {
+    if (!validity_get(valid, i)) {
+      jl_array_ptr_set(a, i, jl_nothing);
+      continue;
+    }
+    int64_t start = packed_offset(offsets, width, i);
+    int64_t end = packed_offset(offsets, width, i + 1);
+    // `bytes` may be NULL when every string is empty
+    v = end > start ? jl_pchar_to_string(bytes + start, (size_t)(end - start))
+                    : jl_pchar_to_string("", 0);
+    jl_array_ptr_set(a, i, v);
+  }
+  JL_GC_POP();
+}
+
+#define JLBUN_PACKED_INT64 0
+#define JLBUN_PACKED_FLOAT64 1
+#define JLBUN_PACKED_BOOL 2
+#define JLBUN_PACKED_STRING 3
+
+// Build a Vector{T} from n packed values, where T is Int64, Float64, Bool
+// (one byte each) or String (UTF-8 `data` split by n + 1 byte `offsets`).
+// With a `valid` bitmap the result is a Vector{Union{Nothing, T}} holding
+// `nothing` where a bit is cleared. Returns NULL on an unknown kind.
+jl_value_t *jlbun_vector_from_packed(int32_t kind, const void *data,
+                                     const int64_t *offsets,
+                                     const uint8_t *valid, size_t n) {
+  jl_value_t *eltype;
+  switch (kind) {
+  case JLBUN_PACKED_INT64:
+    eltype = (jl_value_t *)jl_int64_type;
+    break;
+  case JLBUN_PACKED_FLOAT64:
+    eltype = (jl_value_t *)jl_float64_type;
+    break;
+  case JLBUN_PACKED_BOOL:
+    eltype = (jl_value_t *)jl_bool_type;
+    break;
+  case JLBUN_PACKED_STRING:
+    eltype = (jl_value_t *)jl_string_type;
+    break;
+  default:
+    return NULL;
+  }
+  jl_datatype_t *type = (jl_datatype_t *)eltype;
+
+  jl_value_t *atype = NULL;
+  jl_array_t *a = NULL;
+  JL_GC_PUSH3(&eltype, &atype, &a);
+  if (valid != NULL) {
+    jl_value_t *members[2] = {(jl_value_t *)jl_nothing_type, eltype};
+    eltype = jl_type_union(members, 2);
+  }
+  atype = jl_apply_array_type(eltype, 1);
+  a = jl_alloc_array_1d(atype, n);
+
+  if (kind == JLBUN_PACKED_STRING) {
+    strings_fill(a, (const char *)data, offsets, 8, valid, n);
+  } else {
+    // Plain arrays are one memcpy; unions also set the selector bytes
+    array_write(a, 0, n, type, data, valid, jl_nothing_type);
+  }
+
+  JL_GC_POP();
+  return (jl_value_t *)a;
+}
+
+// Build a Vector{String} from n UTF-8 strings in `bytes`, where string i
+// spans offsets[i] to offsets[i + 1] and `width` is 4 (Int32 offsets) or 8
+// (Int64 offsets). With a `valid` bitmap the result is a
+// Vector{Union{Nothing, String}}. Returns NULL on an unknown width.
+jl_value_t *jlbun_strings_from_packed(const uint8_t *bytes,
+                                      const void *offsets, int32_t width,
+                                      const uint8_t *valid, size_t n) {
+  if (width != 4 && width != 8)
+    return NULL;
+  jl_value_t *eltype = (jl_value_t *)jl_string_type;
+  jl_value_t *atype = NULL;
+  jl_array_t *a = NULL;
+  JL_GC_PUSH3(&eltype, &atype, &a);
+  if (valid != NULL) {
+    jl_value_t *members[2] = {(jl_value_t *)jl_nothing_type, eltype};
+    eltype = jl_type_union(members, 2);
+  }
+  atype = jl_apply_array_type(eltype, 1);
+  a = jl_alloc_array_1d(atype, n);
+  strings_fill(a, (const char *)bytes, offsets, width, valid, n);
+  JL_GC_POP();
+  return (jl_value_t *)a;
+}
+
+// Serialize the n strings of the boxed vector a into `bytes` and n + 1
+// `width`-byte offsets, with offsets[0] = 0. `nothing` and `missing`
+// elements become empty strings with their `valid` bit cleared; without a
+// bitmap they are errors. Offsets are always written, the bytes only if
+// they fit in `capacity`, so a caller with a too small buffer can retry
+// with the returned size. Returns the total byte length, -(i + 1) if
+// element i is not a String (or is absent without a bitmap), or INT64_MIN
+// if the total does not fit in Int32 offsets.
+int64_t jlbun_strings_to_packed(jl_array_t *a, uint8_t *bytes,
+                                size_t capacity, void *offsets,
+                                int32_t width, uint8_t *valid) {
+  if (!jl_array_isboxed(a) || (width != 4 && width != 8))
+    return -1;
+  size_t n = jl_array_len(a);
+  if (valid != NULL)
+    memset(valid, 0, (n + 7) / 8);
+
+  int64_t total = 0;
+  if (width == 4)
+    ((int32_t *)offsets)[0] = 0;
+  else
+    ((int64_t *)offsets)[0] = 0;
+  for (size_t i = 0; i < n; i++) {
+    jl_value_t *v = jl_array_ptr_ref(a, i);
+    if (v != NULL && jl_is_string(v)) {
+      size_t len = jl_string_len(v);
+      if (len != 0 && (size_t)total + len <= capacity)
+        memcpy(bytes + total, jl_string_ptr(v), len);
+      total += (int64_t)len;
+      if (valid != NULL)
+        validity_set(valid, i);
+    } else if (v == NULL || valid == NULL || !is_missing_type(jl_typeof(v))) {
+      return -(int64_t)(i + 1);
+    }
+    if (width == 4) {
+      if (total > INT32_MAX)
+        return INT64_MIN;
+      ((int32_t *)offsets)[i + 1] = (int32_t)total;
+    } else {
+      ((int64_t *)offsets)[i + 1] = total;
+    }
+  }
+  return total;
+}
+
+/* ============================================================================
+ * Scope-based GC Root Management
+ *
+ * Provides FFI-friendly GC rooting with scope isolation for concurrent async
+ * operations. Each scope has a unique ID, allowing independent release without
+ * affecting other scopes.
+ *
+ * Design:
+ *   - Scope-based: each value belongs to a scope_id
+ *   - Sharded: root storage is split into JLBUN_GC_SHARDS shards, each with
+ *     its own mutex, slots and scope table. A scope lives in the shard picked
+ *     by its ID, so pushes and releases of different scopes rarely share a
+ *     lock, and no operation takes a global lock. Slot indices encode their
+ *     shard in the low bits.
+ *   - Concurrent-safe: scopes can be released in any order
+ *   - Slot chains: the slots of each scope form a doubly-linked chain, found
+ *     through a small scope_id -> chain head table, so ending a scope only
+ *     touches that scope's own slots
+ *   - Free list: released slots are reused by later pushes, so holes left by
+ *     escaped values never make the stack grow
+ *   - Segmented: each shard stores its slots in fixed-size segments, each a
+ *     separately rooted Vector{Any} chunk plus C-side metadata. Growth adds
+ *     a segment (allocated outside the shard lock) without copying existing
+ *     slots or calling into Julia code, and segments that stay empty longer
+ *     than the idle threshold are released again, checked when slots are
+ *     released and when scopes begin (scope ids cycle through the shards)
+ *   - Efficient: O(1) push, O(1) single release, O(k) scope release for a
+ *     scope holding k slots
+ *
+ * API:
+ *   - jlbun_gc_scope_begin(): Start a new scope, returns scope_id
+ *   - jlbun_gc_push_scoped(v, scope_id): Push value to specific scope
+ *   - jlbun_gc_scope_end(scope_id): Release all values in scope
+ *   - jlbun_gc_transfer(idx, new_scope_id): Move value to another scope
+ * (escape)
+ *   - jlbun_gc_get_scope(idx): Get scope_id of value at index
+ *   - jlbun_gc_release(idx): Release one slot
+ *   - jlbun_gc_push_scoped_many / jlbun_gc_release_many: Bulk variants
+ *     taking one shard lock per batch
+ *   - jlbun_gc_shard_stats(out): Per-shard lock and occupancy counters
+ *   - jlbun_gc_set_idle_threshold(ms) / jlbun_gc_trim(): Shrink control
+ *   - jlbun_gc_stats(out): Activity counters of both root stacks
+ *
+ * Global scope (id=0):
+ *   - Values in scope_id=0 are never auto-released and are not chained
+ *   - Use for escaped values that should persist until JS GC runs
+ * ============================================================================
+ */
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define JLBUN_GC_NO_SLOT SIZE_MAX
+#define JLBUN_GC_PUSH_FAILED (SIZE_MAX - 1)
+#define JLBUN_GC_FREE_SCOPE UINT64_MAX
+#define JLBUN_GC_INITIAL_CHAINS 64
+#define JLBUN_GC_SHARD_BITS 4
+#define JLBUN_GC_SHARDS (1 << JLBUN_GC_SHARD_BITS)
+#define JLBUN_GC_SHARD_MASK (JLBUN_GC_SHARDS - 1)
+#define JLBUN_GC_SHARD_STATS_FIELDS 4
+#define JLBUN_GC_STATS_FIELDS 22
+#define JLBUN_GC_SEGMENT_BITS 8
+#define JLBUN_GC_SEGMENT_SIZE (1 << JLBUN_GC_SEGMENT_BITS)
+#define JLBUN_GC_SEGMENT_MASK (JLBUN_GC_SEGMENT_SIZE - 1)
+#define JLBUN_GC_INITIAL_TABLE 8
+#define JLBUN_GC_SPARE_SEGMENTS 1
+#define JLBUN_GC_DEFAULT_IDLE_MS 1000
+
+// Public slot indices carry their shard in the low bits
+#define JLBUN_GC_INDEX(local, shard)                                           \
+  (((local) << JLBUN_GC_SHARD_BITS) | (size_t)(shard))
+#define JLBUN_GC_INDEX_SHARD(idx) ((idx) & JLBUN_GC_SHARD_MASK)
+#define JLBUN_GC_INDEX_LOCAL(idx) ((idx) >> JLBUN_GC_SHARD_BITS)
+
+// Shard-local slot indices are (segment << JLBUN_GC_SEGMENT_BITS) | offset
+#define JLBUN_GC_SLOT_SEGMENT(idx) ((idx) >> JLBUN_GC_SEGMENT_BITS)
+#define JLBUN_GC_SLOT_OFFSET(idx) ((idx) & JLBUN_GC_SEGMENT_MASK)
+
+typedef struct {
+  uint64_t scope_id; // Owning scope (0 = empty bucket)
+  size_t head;       // First slot of the scope's chain
+} JlbunScopeChain;
+
+typedef struct JlbunGCSegment {
+  jl_array_t *values;   // Vector{Any} chunk holding this segment's roots
+  size_t index;         // Position in the shard's segment table
+  size_t free_head;     // First free offset in this segment
+  size_t live;          // Number of occupied slots
+  uint64_t empty_since; // Monotonic time (ns) at which the segment emptied
+  struct JlbunGCSegment *avail_prev; // Links in the shard's available list
+  struct JlbunGCSegment *avail_next;
+  int available; // Linked in the available list (has free slots)
+  uint64_t scope_ids[JLBUN_GC_SEGMENT_SIZE]; // Scope ownership for each slot
+  size_t next[JLBUN_GC_SEGMENT_SIZE]; // Next slot in the scope chain or free
+                                      // list
+  size_t prev[JLBUN_GC_SEGMENT_SIZE]; // Previous slot in the scope chain
+} JlbunGCSegment;
+
+// Cumulative activity counters of one shard (lock held to update)
+typedef struct {
+  uint64_t pushes;          // Values rooted by push_scoped(_many)
+  uint64_t releases;        // Slots freed by release(_many) and scope_end
+  uint64_t transfers;       // Successful transfers, including escapes
+  uint64_t escapes;         // Transfers to the global scope (0)
+  uint64_t scope_ends;      // scope_end calls
+  uint64_t slots_scanned;   // Slots visited by scope_end
+  uint64_t max_scope_slots; // Most slots visited by a single scope_end
+  uint64_t high_water;      // Peak number of live slots
+  uint64_t grows;           // Segments added after initialization
+  uint64_t trims;           // Idle segments released
+  uint64_t lock_wait_ns;    // Time spent waiting for the lock
+} JlbunGCCounters;
+
+typedef struct {
+  _Alignas(64) pthread_mutex_t lock; // Protects this shard only
+  size_t id;                         // Position in gc_stack.shards
+  jl_array_t *roots;           // Vector{Any} holding every segment's chunk
+  JlbunGCSegment **segments;   // Segment table (NULL = released segment)
+  size_t table_len;            // Used entries of the segment table
+  size_t table_capacity;       // Allocated entries of the segment table
+  size_t nsegments;            // Allocated segments
+  JlbunGCSegment *avail_head;  // Segments with free slots: partially used
+  JlbunGCSegment *avail_tail;  // ones first, then empty ones by age
+  size_t empty_segments;       // Segments without live slots
+  uint64_t trim_after;         // Earliest time an empty segment turns idle
+  size_t live;                 // Number of occupied slots
+  JlbunScopeChain *chains;     // Open-addressing table: scope_id -> chain head
+  size_t chain_capacity;       // Table size (power of two)
+  size_t chain_count;          // Number of scopes with at least one slot
+  uint64_t acquisitions;       // Times the lock was taken
+  uint64_t contentions;        // Times the lock was already held by another
+                               // thread
+  JlbunGCCounters counters;    // Activity counters for jlbun_gc_stats
+} JlbunGCShard;
+
+typedef struct {
+  JlbunGCShard shards[JLBUN_GC_SHARDS];
+  jl_array_t *roots;      // Vector{Any} holding each shard's segment table
+  uint64_t next_scope_id; // Atomic counter for generating unique scope IDs
+  uint64_t idle_ns;       // Atomic: empty segments older than this are freed
+  int initialized;        // Atomic initialization flag
+  int locks_ready;        // Shard mutexes have been initialized
+  pthread_mutex_t lock;   // Serializes init and close
+} JlbunGCStack;
+
+static JlbunGCStack gc_stack = {
+    .next_scope_id = 1,
+    .idle_ns = JLBUN_GC_DEFAULT_IDLE_MS * 1000000ull,
+    .lock = PTHREAD_MUTEX_INITIALIZER};
+
+// Shard used for global (scope 0) pushes from the current thread
+static _Thread_local int gc_thread_shard = -1;
+static unsigned gc_next_thread_shard = 0;
+
+STATIC_INLINE int gc_is_initialized(void) {
+  return __atomic_load_n(&gc_stack.initialized, __ATOMIC_ACQUIRE);
+}
+
+STATIC_INLINE uint64_t gc_now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+// Scopes are spread over the shards by ID. Global values pushed directly into
+// scope 0 go to a per-thread shard so that threads do not share a lock.
+STATIC_INLINE size_t gc_scope_shard(uint64_t scope_id) {
+  if (scope_id != 0)
+    return (size_t)(scope_id & JLBUN_GC_SHARD_MASK);
+  if (gc_thread_shard < 0)
+    gc_thread_shard =
+        (int)(__atomic_fetch_add(&gc_next_thread_shard, 1, __ATOMIC_RELAXED) &
+              JLBUN_GC_SHARD_MASK);
+  return (size_t)gc_thread_shard;
+}
+
+// Take a shard lock, counting acquisitions that had to wait and for how long
+STATIC_INLINE void shard_lock(JlbunGCShard *s) {
+  if (pthread_mutex_trylock(&s->lock) != 0) {
+    uint64_t start = gc_now_ns();
+    pthread_mutex_lock(&s->lock);
+    s->contentions++;
+    s->counters.lock_wait_ns += gc_now_ns() - start;
+  }
+  s->acquisitions++;
+}
+
+STATIC_INLINE void shard_unlock(JlbunGCShard *s) {
+  pthread_mutex_unlock(&s->lock);
+}
+
+STATIC_INLINE size_t chain_bucket(uint64_t scope_id, size_t capacity) {
+  // Fibonacci hashing spreads the scope IDs of a shard over its table
+  return (size_t)((scope_id * 0x9E3779B97F4A7C15ull) >> 32) & (capacity - 1);
+}
+
+// Find the chain of a scope (lock held). Returns NULL if the scope owns no
+// slots.
+static JlbunScopeChain *chain_find(JlbunGCShard *s, uint64_t scope_id) {
+  size_t mask = s->chain_capacity - 1;
+  size_t i = chain_bucket(scope_id, s->chain_capacity);
+  while (s->chains[i].scope_id != 0) {
+    if (s->chains[i].scope_id == scope_id)
+      return &s->chains[i];
+    i = (i + 1) & mask;
+  }
+  return NULL;
+}
+
+// Double the chain table (lock held)
+static int chain_grow(JlbunGCShard *s) {
+  size_t new_cap = s->chain_capacity * 2;
+  JlbunScopeChain *new_chains =
+      (JlbunScopeChain *)calloc(new_cap, sizeof(JlbunScopeChain));
+  if (new_chains == NULL)
+    return 0;
+
+  for (size_t i = 0; i < s->chain_capacity; i++) {
+    JlbunScopeChain c = s->chains[i];
+    if (c.scope_id == 0)
+      continue;
+    size_t j = chain_bucket(c.scope_id, new_cap);
+    while (new_chains[j].scope_id != 0)
+      j = (j + 1) & (new_cap - 1);
+    new_chains[j] = c;
+  }
+
+  free(s->chains);
+  s->chains = new_chains;
+  s->chain_capacity = new_cap;
+  return 1;
+}
+
+// Find or create the chain of a scope (lock held)
+static JlbunScopeChain *chain_get(JlbunGCShard *s, uint64_t scope_id) {
+  JlbunScopeChain *c = chain_find(s, scope_id);
+  if (c != NULL)
+    return c;
+
+  // Keep the load factor at or below 1/2
+  if ((s->chain_count + 1) * 2 > s->chain_capacity && !chain_grow(s))
+    return NULL;
+
+  size_t mask = s->chain_capacity - 1;
+  size_t i = chain_bucket(scope_id, s->chain_capacity);
+  while (s->chains[i].scope_id != 0)
+    i = (i + 1) & mask;
+  s->chains[i].scope_id = scope_id;
+  s->chains[i].head = JLBUN_GC_NO_SLOT;
+  s->chain_count++;
+  return &s->chains[i];
+}
+
+// Remove a chain from the table with backward-shift deletion (lock held)
+static void chain_remove(JlbunGCShard *s, JlbunScopeChain *c) {
+  size_t mask = s->chain_capacity - 1;
+  size_t hole = (size_t)(c - s->chains);
+  size_t i = (hole + 1) & mask;
+  while (s->chains[i].scope_id != 0) {
+    size_t home = chain_bucket(s->chains[i].scope_id, s->chain_capacity);
+    // Move the entry into the hole unless its home lies in (hole, i]
+    if (((i - home) & mask) >= ((i - hole) & mask)) {
+      s->chains[hole] = s->chains[i];
+      hole = i;
+    }
+    i = (i + 1) & mask;
+  }
+  s->chains[hole].scope_id = 0;
+  s->chains[hole].head = JLBUN_GC_NO_SLOT;
+  s->chain_count--;
+}
+
+// Segment holding a shard-local slot (slot known to be valid)
+STATIC_INLINE JlbunGCSegment *slot_segment(JlbunGCShard *s, size_t idx) {
+  return s->segments[JLBUN_GC_SLOT_SEGMENT(idx)];
+}
+
+STATIC_INLINE int slot_is_live(JlbunGCShard *s, size_t idx) {
+  size_t seg = JLBUN_GC_SLOT_SEGMENT(idx);
+  return s->segments != NULL && seg < s->table_len &&
+         s->segments[seg] != NULL &&
+         s->segments[seg]->scope_ids[JLBUN_GC_SLOT_OFFSET(idx)] !=
+             JLBUN_GC_FREE_SCOPE;
+}
+
+// Link a slot at the head of its scope chain (lock held)
+static int slot_link(JlbunGCShard *s, size_t idx, uint64_t scope_id) {
+  JlbunGCSegment *seg = slot_segment(s, idx);
+  size_t off = JLBUN_GC_SLOT_OFFSET(idx);
+  seg->prev[off] = JLBUN_GC_NO_SLOT;
+  seg->next[off] = JLBUN_GC_NO_SLOT;
+  if (scope_id == 0)
+    return 1;
+
+  JlbunScopeChain *c = chain_get(s, scope_id);
+  if (c == NULL)
+    return 0;
+  seg->next[off] = c->head;
+  if (c->head != JLBUN_GC_NO_SLOT)
+    slot_segment(s, c->head)->prev[JLBUN_GC_SLOT_OFFSET(c->head)] = idx;
+  c->head = idx;
+  return 1;
+}
+
+// Unlink a slot from its scope chain (lock held)
+static void slot_unlink(JlbunGCShard *s, size_t idx) {
+  JlbunGCSegment *seg = slot_segment(s, idx);
+  size_t off = JLBUN_GC_SLOT_OFFSET(idx);
+  uint64_t scope_id = seg->scope_ids[off];
+  if (scope_id == 0)
     return;
+
+  size_t prev = seg->prev[off];
+  size_t next = seg->next[off];
+  if (next != JLBUN_GC_NO_SLOT)
+    slot_segment(s, next)->prev[JLBUN_GC_SLOT_OFFSET(next)] = prev;
+  if (prev != JLBUN_GC_NO_SLOT) {
+    slot_segment(s, prev)->next[JLBUN_GC_SLOT_OFFSET(prev)] = next;
+  } else {
+    JlbunScopeChain *c = chain_find(s, scope_id);
+    if (c != NULL) {
+      c->head = next;
+      if (next == JLBUN_GC_NO_SLOT)
+        chain_remove(s, c);
+    }
   }
+}
 
-  jl_array_ptr_set(gc_stack.values, idx, v);
+// Available list helpers (lock held)
+static void avail_remove(JlbunGCShard *s, JlbunGCSegment *seg) {
+  if (!seg->available)
+    return;
+  if (seg->avail_prev != NULL)
+    seg->avail_prev->avail_next = seg->avail_next;
+  else
+    s->avail_head = seg->avail_next;
+  if (seg->avail_next != NULL)
+    seg->avail_next->avail_prev = seg->avail_prev;
+  else
+    s->avail_tail = seg->avail_prev;
+  seg->avail_prev = NULL;
+  seg->avail_next = NULL;
+  seg->available = 0;
+}
 
-  pthread_mutex_unlock(&gc_stack.lock);
+static void avail_push_head(JlbunGCShard *s, JlbunGCSegment *seg) {
+  seg->avail_prev = NULL;
+  seg->avail_next = s->avail_head;
+  if (s->avail_head != NULL)
+    s->avail_head->avail_prev = seg;
+  else
+    s->avail_tail = seg;
+  s->avail_head = seg;
+  seg->available = 1;
 }
 
-// Release a single slot. Intended for temporary roots created during wrapping.
-void jlbun_gc_release(size_t idx) {
+static void avail_push_tail(JlbunGCShard *s, JlbunGCSegment *seg) {
+  seg->avail_next = NULL;
+  seg->avail_prev = s->avail_tail;
+  if (s->avail_tail != NULL)
+    s->avail_tail->avail_next = seg;
+  else
+    s->avail_head = seg;
+  s->avail_tail = seg;
+  seg->available = 1;
+}
+
+// Take a free slot from the first available segment (lock held). Partially
+// used segments come first, so empty segments stay empty and can be trimmed.
+// Returns JLBUN_GC_NO_SLOT if every segment is full.
+static size_t slot_take(JlbunGCShard *s) {
+  JlbunGCSegment *seg = s->avail_head;
+  if (seg == NULL)
+    return JLBUN_GC_NO_SLOT;
+
+  size_t off = seg->free_head;
+  seg->free_head = seg->next[off];
+  if (seg->live++ == 0)
+    s->empty_segments--;
+  if (seg->free_head == JLBUN_GC_NO_SLOT)
+    avail_remove(s, seg);
+  if (++s->live > s->counters.high_water)
+    s->counters.high_water = s->live;
+  return (seg->index << JLBUN_GC_SEGMENT_BITS) | off;
+}
+
+// Clear a slot and put it on its segment's free list (lock held, slot
+// unlinked)
+static void slot_free(JlbunGCShard *s, size_t idx) {
+  JlbunGCSegment *seg = slot_segment(s, idx);
+  size_t off = JLBUN_GC_SLOT_OFFSET(idx);
+  jl_array_ptr_set(seg->values, off, jl_nothing);
+  seg->scope_ids[off] = JLBUN_GC_FREE_SCOPE;
+  seg->next[off] = seg->free_head;
+  seg->free_head = off;
+  s->live--;
+
+  if (--seg->live == 0) {
+    // Empty segments wait at the tail until they are reused or trimmed
+    avail_remove(s, seg);
+    avail_push_tail(s, seg);
+    seg->empty_since = gc_now_ns();
+    uint64_t idle_at =
+        seg->empty_since + __atomic_load_n(&gc_stack.idle_ns, __ATOMIC_RELAXED);
+    if (s->empty_segments++ == 0 || idle_at < s->trim_after)
+      s->trim_after = idle_at;
+  } else if (!seg->available) {
+    avail_push_head(s, seg);
+  }
+}
+
+// Allocate the C side of a segment with every slot on its free list. Does not
+// touch the Julia heap, so it can run outside the shard lock.
+static JlbunGCSegment *segment_new(void) {
+  JlbunGCSegment *seg = (JlbunGCSegment *)malloc(sizeof(JlbunGCSegment));
+  if (seg == NULL)
+    return NULL;
+  seg->values = NULL;
+  seg->index = 0;
+  seg->free_head = 0;
+  seg->live = 0;
+  seg->empty_since = 0;
+  seg->avail_prev = NULL;
+  seg->avail_next = NULL;
+  seg->available = 0;
+  for (size_t i = 0; i < JLBUN_GC_SEGMENT_SIZE; i++) {
+    seg->scope_ids[i] = JLBUN_GC_FREE_SCOPE;
+    seg->next[i] = i + 1 < JLBUN_GC_SEGMENT_SIZE ? i + 1 : JLBUN_GC_NO_SLOT;
+  }
+  return seg;
+}
+
+// Swap in a larger segment table (lock held). `table` is a Vector{Any} of
+// `capacity` entries allocated by the caller; only the segment pointers are
+// copied, never the roots themselves.
+static int shard_install_table(JlbunGCShard *s, jl_array_t *table,
+                               size_t capacity) {
+  if (capacity <= s->table_capacity)
+    return 1;
+  JlbunGCSegment **segments = (JlbunGCSegment **)realloc(
+      s->segments, capacity * sizeof(JlbunGCSegment *));
+  if (segments == NULL)
+    return 0;
+  for (size_t i = s->table_capacity; i < capacity; i++)
+    segments[i] = NULL;
+  for (size_t i = 0; i < s->table_len; i++)
+    jl_array_ptr_set(table, i,
+                     segments[i] != NULL ? (jl_value_t *)segments[i]->values
+                                         : jl_nothing);
+  jl_array_ptr_set(gc_stack.roots, s->id, (jl_value_t *)table);
+  s->segments = segments;
+  s->roots = table;
+  s->table_capacity = capacity;
+  return 1;
+}
+
+// Add a segment to the shard (lock held). Reuses the lowest released entry of
+// the segment table. Returns 0 if the table is full.
+static int shard_install_segment(JlbunGCShard *s, JlbunGCSegment *seg,
+                                 jl_array_t *values) {
+  size_t index = 0;
+  while (index < s->table_len && s->segments[index] != NULL)
+    index++;
+  if (index == s->table_len) {
+    if (s->table_len == s->table_capacity)
+      return 0;
+    s->table_len++;
+  }
+
+  seg->index = index;
+  seg->values = values;
+  jl_array_ptr_set(s->roots, index, (jl_value_t *)values);
+  s->segments[index] = seg;
+  s->nsegments++;
+  // A fresh segment counts as empty until its first push
+  seg->empty_since = gc_now_ns();
+  uint64_t idle_at =
+      seg->empty_since + __atomic_load_n(&gc_stack.idle_ns, __ATOMIC_RELAXED);
+  if (s->empty_segments++ == 0 || idle_at < s->trim_after)
+    s->trim_after = idle_at;
+  avail_push_tail(s, seg);
+  return 1;
+}
+
+// Drop an empty segment (lock held). Its chunk becomes garbage for Julia.
+static void segment_release(JlbunGCShard *s, JlbunGCSegment *seg) {
+  avail_remove(s, seg);
+  jl_array_ptr_set(s->roots, seg->index, jl_nothing);
+  s->segments[seg->index] = NULL;
+  while (s->table_len > 0 && s->segments[s->table_len - 1] == NULL)
+    s->table_len--;
+  s->nsegments--;
+  s->empty_segments--;
+  s->counters.trims++;
+  free(seg);
+}
+
+// Release empty segments idle for at least `idle_ns`, keeping
+// JLBUN_GC_SPARE_SEGMENTS of the most recently emptied ones (lock held).
+// Returns the number of released segments.
+static size_t shard_trim_locked(JlbunGCShard *s, uint64_t now,
+                                uint64_t idle_ns) {
+  size_t released = 0;
+  size_t kept = 0;
+  uint64_t next_trim = UINT64_MAX;
+  JlbunGCSegment *seg = s->avail_tail;
+  while (seg != NULL && seg->live == 0) {
+    JlbunGCSegment *prev = seg->avail_prev;
+    if (kept < JLBUN_GC_SPARE_SEGMENTS) {
+      kept++;
+    } else if (now - seg->empty_since >= idle_ns) {
+      segment_release(s, seg);
+      released++;
+    } else if (seg->empty_since + idle_ns < next_trim) {
+      next_trim = seg->empty_since + idle_ns;
+    }
+    seg = prev;
+  }
+  s->trim_after = next_trim;
+  return released;
+}
+
+// Trim once the oldest empty segment has been idle long enough (lock held)
+STATIC_INLINE void shard_maybe_trim(JlbunGCShard *s) {
+  if (s->empty_segments <= JLBUN_GC_SPARE_SEGMENTS)
+    return;
+  uint64_t now = gc_now_ns();
+  if (now >= s->trim_after)
+    shard_trim_locked(s, now,
+                      __atomic_load_n(&gc_stack.idle_ns, __ATOMIC_RELAXED));
+}
+
+STATIC_INLINE size_t shard_free_slots(JlbunGCShard *s) {
+  return s->nsegments * JLBUN_GC_SEGMENT_SIZE - s->live;
+}
+
+// Make sure a shard has at least `needed` free slots, growing it by whole
+// segments if needed. Must be called WITHOUT the shard lock: the Julia
+// allocations happen outside of it so that a GC triggered by them never runs
+// while the lock is held. Returns 0 on allocation failure.
+static int shard_reserve(JlbunGCShard *s, size_t needed) {
+  jl_value_t *values = NULL;
+  jl_value_t *table = NULL;
+  size_t table_capacity = 0;
+  JlbunGCSegment *seg = NULL;
+  int ok = 0;
+
+  JL_GC_PUSH2(&values, &table);
+  for (;;) {
+    if (seg == NULL) {
+      seg = segment_new();
+      if (seg == NULL)
+        break;
+      values = (jl_value_t *)jl_alloc_vec_any(JLBUN_GC_SEGMENT_SIZE);
+    }
+
+    shard_lock(s);
+    if (s->segments == NULL) {
+      shard_unlock(s);
+      break; // Closed concurrently
+    }
+    if (shard_free_slots(s) >= needed) {
+      shard_unlock(s);
+      ok = 1; // Enough room, possibly grown by another thread
+      break;
+    }
+    if (table != NULL &&
+        !shard_install_table(s, (jl_array_t *)table, table_capacity)) {
+      shard_unlock(s);
+      break;
+    }
+    if (shard_install_segment(s, seg, (jl_array_t *)values)) {
+      // Installed: allocate the next segment if still short
+      s->counters.grows++;
+      seg = NULL;
+      values = NULL;
+      shard_unlock(s);
+      continue;
+    }
+    // The segment table is full: allocate a larger one and retry
+    table_capacity = s->table_capacity * 2;
+    shard_unlock(s);
+    table = (jl_value_t *)jl_alloc_vec_any(table_capacity);
+  }
+  JL_GC_POP();
+
+  free(seg);
+  return ok;
+}
+
+// Take a slot in a shard and store v in it (lock held). Returns the local
+// slot index, JLBUN_GC_NO_SLOT if the shard must grow first (see
+// shard_reserve), or JLBUN_GC_PUSH_FAILED.
+static size_t shard_push_locked(JlbunGCShard *s, jl_value_t *v,
+                                uint64_t scope_id) {
+  if (s->segments == NULL)
+    return JLBUN_GC_PUSH_FAILED;
+  if (s->avail_head == NULL)
+    return JLBUN_GC_NO_SLOT;
+  // Create the scope chain first so that linking below cannot fail
+  if (scope_id != 0 && chain_get(s, scope_id) == NULL)
+    return JLBUN_GC_PUSH_FAILED;
+
+  size_t idx = slot_take(s);
+  JlbunGCSegment *seg = slot_segment(s, idx);
+  slot_link(s, idx, scope_id);
+  jl_array_ptr_set(seg->values, JLBUN_GC_SLOT_OFFSET(idx), v);
+  seg->scope_ids[JLBUN_GC_SLOT_OFFSET(idx)] = scope_id;
+  return idx;
+}
+
+// Free the C-side metadata of a shard (lock held or shard unused)
+static void shard_free_metadata(JlbunGCShard *s) {
+  for (size_t i = 0; i < s->table_len; i++)
+    free(s->segments[i]);
+  free(s->segments);
+  free(s->chains);
+  s->roots = NULL;
+  s->segments = NULL;
+  s->table_len = 0;
+  s->table_capacity = 0;
+  s->nsegments = 0;
+  s->avail_head = NULL;
+  s->avail_tail = NULL;
+  s->empty_segments = 0;
+  s->trim_after = 0;
+  s->live = 0;
+  s->chains = NULL;
+  s->chain_capacity = 0;
+  s->chain_count = 0;
+}
+
+// Set up one shard with `nsegments` segments (init lock held, shard unused)
+static int shard_init(JlbunGCShard *s, size_t nsegments) {
+  size_t table_capacity = JLBUN_GC_INITIAL_TABLE;
+  while (table_capacity < nsegments)
+    table_capacity *= 2;
+
+  jl_array_t *table = jl_alloc_vec_any(table_capacity);
+  jl_array_ptr_set(gc_stack.roots, s->id, (jl_value_t *)table);
+  s->roots = table;
+  s->segments =
+      (JlbunGCSegment **)calloc(table_capacity, sizeof(JlbunGCSegment *));
+  s->chains = (JlbunScopeChain *)calloc(JLBUN_GC_INITIAL_CHAINS,
+                                        sizeof(JlbunScopeChain));
+  if (s->segments == NULL || s->chains == NULL)
+    return 0;
+  s->table_capacity = table_capacity;
+  s->chain_capacity = JLBUN_GC_INITIAL_CHAINS;
+  s->acquisitions = 0;
+  s->contentions = 0;
+  memset(&s->counters, 0, sizeof(s->counters));
+
+  for (size_t i = 0; i < nsegments; i++) {
+    JlbunGCSegment *seg = segment_new();
+    if (seg == NULL)
+      return 0;
+    // The chunk is rooted by the table right after allocation
+    shard_install_segment(s, seg, jl_alloc_vec_any(JLBUN_GC_SEGMENT_SIZE));
+  }
+  return 1;
+}
+
+// Initialize the GC root stack
+void jlbun_gc_init(size_t initial_capacity) {
   pthread_mutex_lock(&gc_stack.lock);
 
-  if (!gc_stack.initialized || idx >= gc_stack.top) {
+  if (gc_is_initialized()) {
     pthread_mutex_unlock(&gc_stack.lock);
-    return;
+    return; // Already initialized
   }
 
-  jl_array_ptr_set(gc_stack.values, idx, jl_nothing);
-  gc_stack.scope_ids[idx] = 0;
+  if (!gc_stack.locks_ready) {
+    for (int i = 0; i < JLBUN_GC_SHARDS; i++) {
+      pthread_mutex_init(&gc_stack.shards[i].lock, NULL);
+      gc_stack.shards[i].id = (size_t)i;
+    }
+    gc_stack.locks_ready = 1;
+  }
+
+  // The initial capacity is split evenly over the shards, in whole segments
+  size_t shard_capacity =
+      (initial_capacity + JLBUN_GC_SHARDS - 1) / JLBUN_GC_SHARDS;
+  size_t nsegments =
+      (shard_capacity + JLBUN_GC_SEGMENT_SIZE - 1) / JLBUN_GC_SEGMENT_SIZE;
+  if (nsegments == 0)
+    nsegments = 1;
+
+  // Julia 1.12+ requires declaring global before assignment
+  // Use eval to declare and assign in one step. The global keeps every
+  // shard's segment table (and through it every segment) reachable.
+  char eval_buf[256];
+  snprintf(eval_buf, sizeof(eval_buf),
+           "global __jlbun_gc_stack__::Vector{Any} = Vector{Any}(nothing, %d)",
+           JLBUN_GC_SHARDS);
+  jl_eval_string(eval_buf);
+
+  jl_value_t *roots =
+      jl_get_global(jl_main_module, jl_symbol("__jlbun_gc_stack__"));
+  if (roots == NULL || !jl_is_array(roots)) {
+    pthread_mutex_unlock(&gc_stack.lock);
+    return; // Storage allocation failed
+  }
+  gc_stack.roots = (jl_array_t *)roots;
 
-  while (gc_stack.top > 0 && gc_stack.scope_ids[gc_stack.top - 1] == 0 &&
-         jl_array_ptr_ref(gc_stack.values, gc_stack.top - 1) == jl_nothing) {
-    gc_stack.top--;
+  for (int i = 0; i < JLBUN_GC_SHARDS; i++) {
+    if (!shard_init(&gc_stack.shards[i], nsegments)) {
+      for (int j = 0; j <= i; j++)
+        shard_free_metadata(&gc_stack.shards[j]);
+      gc_stack.roots = NULL;
+      pthread_mutex_unlock(&gc_stack.lock);
+      return; // Allocation failed
+    }
   }
 
+  __atomic_store_n(&gc_stack.next_scope_id, 1,
+                   __ATOMIC_RELAXED); // 0 is reserved for global/legacy
+  __atomic_store_n(&gc_stack.initialized, 1, __ATOMIC_RELEASE);
   pthread_mutex_unlock(&gc_stack.lock);
 }
 
+// Begin a new scope, returns unique scope_id
+uint64_t jlbun_gc_scope_begin(void) {
+  if (!gc_is_initialized())
+    return 0; // Error: not initialized, return invalid scope_id
+
+  uint64_t scope_id =
+      __atomic_fetch_add(&gc_stack.next_scope_id, 1, __ATOMIC_RELAXED);
+  // A shard that only sees new scopes after a burst releases nothing, so
+  // give it the chance to trim here too; the lock is only taken once its
+  // oldest empty segment has been idle long enough
+  JlbunGCShard *s = &gc_stack.shards[gc_scope_shard(scope_id)];
+  if (__atomic_load_n(&s->empty_segments, __ATOMIC_RELAXED) >
+          JLBUN_GC_SPARE_SEGMENTS &&
+      gc_now_ns() >= __atomic_load_n(&s->trim_after, __ATOMIC_RELAXED)) {
+    shard_lock(s);
+    shard_maybe_trim(s);
+    shard_unlock(s);
+  }
+  return scope_id;
+}
+
+// Push a value with explicit scope_id, returns index
+size_t jlbun_gc_push_scoped(jl_value_t *v, uint64_t scope_id) {
+  if (!gc_is_initialized() || scope_id == JLBUN_GC_FREE_SCOPE)
+    return SIZE_MAX; // Error: not initialized
+
+  size_t shard = gc_scope_shard(scope_id);
+  JlbunGCShard *s = &gc_stack.shards[shard];
+  JL_GC_PUSH1(&v);
+  shard_lock(s);
+  size_t idx = shard_push_locked(s, v, scope_id);
+  while (idx == JLBUN_GC_NO_SLOT) {
+    // Grow outside the lock, then retry
+    shard_unlock(s);
+    if (!shard_reserve(s, 1)) {
+      JL_GC_POP();
+      return SIZE_MAX;
+    }
+    shard_lock(s);
+    idx = shard_push_locked(s, v, scope_id);
+  }
+  if (idx != JLBUN_GC_PUSH_FAILED)
+    s->counters.pushes++;
+  shard_unlock(s);
+  JL_GC_POP();
+  return idx == JLBUN_GC_PUSH_FAILED ? SIZE_MAX : JLBUN_GC_INDEX(idx, shard);
+}
+
+// End a scope: release all values belonging to this scope_id. Returns the
+// number of released slots.
+size_t jlbun_gc_scope_end(uint64_t scope_id) {
+  if (!gc_is_initialized() || scope_id == 0)
+    return 0; // scope_id=0 is global, never auto-released
+
+  JlbunGCShard *s = &gc_stack.shards[gc_scope_shard(scope_id)];
+  shard_lock(s);
+
+  // Walk the scope's own chain; escaped slots have already left it
+  JlbunScopeChain *c = s->chains != NULL ? chain_find(s, scope_id) : NULL;
+  size_t freed = 0;
+  if (c != NULL) {
+    size_t idx = c->head;
+    chain_remove(s, c);
+    while (idx != JLBUN_GC_NO_SLOT) {
+      size_t next = slot_segment(s, idx)->next[JLBUN_GC_SLOT_OFFSET(idx)];
+      slot_free(s, idx);
+      idx = next;
+      freed++;
+    }
+    shard_maybe_trim(s);
+  }
+  s->counters.scope_ends++;
+  s->counters.slots_scanned += freed;
+  s->counters.releases += freed;
+  if (freed > s->counters.max_scope_slots)
+    s->counters.max_scope_slots = freed;
+
+  shard_unlock(s);
+  return freed;
+}
+
+// Transfer a value to a different scope (for escape)
+// Returns the new index, or SIZE_MAX on error. Transfers to scope 0 or to a
+// scope of the same shard keep the index; otherwise the value moves to the
+// target scope's shard and gets a new index.
+size_t jlbun_gc_transfer(size_t idx, uint64_t new_scope_id) {
+  if (!gc_is_initialized() || new_scope_id == JLBUN_GC_FREE_SCOPE)
+    return SIZE_MAX;
+
+  size_t src_shard = JLBUN_GC_INDEX_SHARD(idx);
+  size_t local = JLBUN_GC_INDEX_LOCAL(idx);
+  size_t dst_shard =
+      new_scope_id == 0 ? src_shard : gc_scope_shard(new_scope_id);
+  JlbunGCShard *src = &gc_stack.shards[src_shard];
+  JlbunGCShard *dst = &gc_stack.shards[dst_shard];
+
+  size_t result = SIZE_MAX;
+  for (;;) {
+    // Take both locks in shard order so that concurrent moves cannot deadlock
+    if (dst_shard < src_shard)
+      shard_lock(dst);
+    shard_lock(src);
+    if (dst_shard > src_shard)
+      shard_lock(dst);
+
+    size_t moved = JLBUN_GC_PUSH_FAILED;
+    if (slot_is_live(src, local)) {
+      if (src == dst) {
+        // Make sure the target chain exists before touching the source chain
+        if (new_scope_id == 0 || chain_get(src, new_scope_id) != NULL) {
+          slot_unlink(src, local);
+          slot_link(src, local, new_scope_id);
+          slot_segment(src, local)->scope_ids[JLBUN_GC_SLOT_OFFSET(local)] =
+              new_scope_id;
+          result = idx;
+        }
+      } else {
+        jl_value_t *v = jl_array_ptr_ref(slot_segment(src, local)->values,
+                                         JLBUN_GC_SLOT_OFFSET(local));
+        moved = shard_push_locked(dst, v, new_scope_id);
+        if (moved != JLBUN_GC_NO_SLOT && moved != JLBUN_GC_PUSH_FAILED) {
+          slot_unlink(src, local);
+          slot_free(src, local);
+          result = JLBUN_GC_INDEX(moved, dst_shard);
+        }
+      }
+    }
+
+    if (result != SIZE_MAX) {
+      src->counters.transfers++;
+      if (new_scope_id == 0)
+        src->counters.escapes++;
+    }
+    if (dst != src)
+      shard_unlock(dst);
+    shard_unlock(src);
+    // Grow the target shard outside the locks, then retry
+    if (moved != JLBUN_GC_NO_SLOT || !shard_reserve(dst, 1))
+      break;
+  }
+  return result;
+}
+
+// Get the scope_id of a value at index
+uint64_t jlbun_gc_get_scope(size_t idx) {
+  if (!gc_is_initialized())
+    return 0;
+
+  JlbunGCShard *s = &gc_stack.shards[JLBUN_GC_INDEX_SHARD(idx)];
+  size_t local = JLBUN_GC_INDEX_LOCAL(idx);
+  shard_lock(s);
+  uint64_t scope_id =
+      slot_is_live(s, local)
+          ? slot_segment(s, local)->scope_ids[JLBUN_GC_SLOT_OFFSET(local)]
+          : 0;
+  shard_unlock(s);
+  return scope_id;
+}
+
+// Get value at index (for debugging/escape)
+// Thread-safe: protects against concurrent modifications
+jl_value_t *jlbun_gc_get(size_t idx) {
+  if (!gc_is_initialized())
+    return jl_nothing;
+
+  JlbunGCShard *s = &gc_stack.shards[JLBUN_GC_INDEX_SHARD(idx)];
+  size_t local = JLBUN_GC_INDEX_LOCAL(idx);
+  shard_lock(s);
+  jl_value_t *val = slot_is_live(s, local)
+                        ? jl_array_ptr_ref(slot_segment(s, local)->values,
+                                           JLBUN_GC_SLOT_OFFSET(local))
+                        : jl_nothing;
+  shard_unlock(s);
+  return val;
+}
+
+// Set value at index (replace the value held by a live slot)
+void jlbun_gc_set(size_t idx, jl_value_t *v) {
+  if (!gc_is_initialized())
+    return;
+
+  JlbunGCShard *s = &gc_stack.shards[JLBUN_GC_INDEX_SHARD(idx)];
+  size_t local = JLBUN_GC_INDEX_LOCAL(idx);
+  shard_lock(s);
+  if (slot_is_live(s, local))
+    jl_array_ptr_set(slot_segment(s, local)->values,
+                     JLBUN_GC_SLOT_OFFSET(local), v);
+  shard_unlock(s);
+}
+
+// Release a single slot and return it to the free list. Used for temporary
+// roots created during wrapping and for escaped values collected by JS.
+void jlbun_gc_release(size_t idx) {
+  if (!gc_is_initialized())
+    return;
+
+  JlbunGCShard *s = &gc_stack.shards[JLBUN_GC_INDEX_SHARD(idx)];
+  size_t local = JLBUN_GC_INDEX_LOCAL(idx);
+  shard_lock(s);
+  if (slot_is_live(s, local)) {
+    slot_unlink(s, local);
+    slot_free(s, local);
+    s->counters.releases++;
+    shard_maybe_trim(s);
+  }
+  shard_unlock(s);
+}
+
+// Push n values into one scope with a single lock acquisition. The slot
+// index of ptrs[i] is written to out_idx[i]. The values must be kept alive by
+// the caller until the call returns. Returns n on success, or 0 on failure
+// (nothing is pushed).
+size_t jlbun_gc_push_scoped_many(jl_value_t **ptrs, size_t n,
+                                 uint64_t scope_id, size_t *out_idx) {
+  if (!gc_is_initialized() || scope_id == JLBUN_GC_FREE_SCOPE || n == 0)
+    return 0;
+
+  size_t shard = gc_scope_shard(scope_id);
+  JlbunGCShard *s = &gc_stack.shards[shard];
+  shard_lock(s);
+  while (s->segments != NULL && shard_free_slots(s) < n) {
+    // Grow outside the lock, then retry
+    shard_unlock(s);
+    if (!shard_reserve(s, n))
+      return 0;
+    shard_lock(s);
+  }
+  if (s->segments == NULL ||
+      (scope_id != 0 && chain_get(s, scope_id) == NULL)) {
+    shard_unlock(s);
+    return 0;
+  }
+
+  for (size_t i = 0; i < n; i++) {
+    size_t idx = slot_take(s);
+    JlbunGCSegment *seg = slot_segment(s, idx);
+    slot_link(s, idx, scope_id);
+    jl_array_ptr_set(seg->values, JLBUN_GC_SLOT_OFFSET(idx), ptrs[i]);
+    seg->scope_ids[JLBUN_GC_SLOT_OFFSET(idx)] = scope_id;
+    out_idx[i] = JLBUN_GC_INDEX(idx, shard);
+  }
+  s->counters.pushes += n;
+
+  shard_unlock(s);
+  return n;
+}
+
+// Release n slots. Runs of slots in the same shard (the usual case for slots
+// pushed together) share one lock acquisition. Slots that are already free
+// are skipped.
+void jlbun_gc_release_many(const size_t *idx, size_t n) {
+  if (!gc_is_initialized())
+    return;
+
+  JlbunGCShard *locked = NULL;
+  for (size_t i = 0; i < n; i++) {
+    JlbunGCShard *s = &gc_stack.shards[JLBUN_GC_INDEX_SHARD(idx[i])];
+    if (s != locked) {
+      if (locked != NULL) {
+        shard_maybe_trim(locked);
+        shard_unlock(locked);
+      }
+      shard_lock(s);
+      locked = s;
+    }
+    size_t local = JLBUN_GC_INDEX_LOCAL(idx[i]);
+    if (slot_is_live(s, local)) {
+      slot_unlink(s, local);
+      slot_free(s, local);
+      s->counters.releases++;
+    }
+  }
+  if (locked != NULL) {
+    shard_maybe_trim(locked);
+    shard_unlock(locked);
+  }
+}
+
 // Get stack statistics (thread-safe)
 size_t jlbun_gc_size(void) {
-  pthread_mutex_lock(&gc_stack.lock);
-  size_t size = gc_stack.top;
-  pthread_mutex_unlock(&gc_stack.lock);
+  if (!gc_is_initialized())
+    return 0;
+
+  size_t size = 0;
+  for (int i = 0; i < JLBUN_GC_SHARDS; i++) {
+    JlbunGCShard *s = &gc_stack.shards[i];
+    pthread_mutex_lock(&s->lock);
+    size += s->live;
+    pthread_mutex_unlock(&s->lock);
+  }
   return size;
 }
 
+// Number of slots held by allocated segments (the real footprint)
 size_t jlbun_gc_capacity(void) {
-  pthread_mutex_lock(&gc_stack.lock);
-  size_t cap = gc_stack.capacity;
-  pthread_mutex_unlock(&gc_stack.lock);
+  if (!gc_is_initialized())
+    return 0;
+
+  size_t cap = 0;
+  for (int i = 0; i < JLBUN_GC_SHARDS; i++) {
+    JlbunGCShard *s = &gc_stack.shards[i];
+    pthread_mutex_lock(&s->lock);
+    cap += s->nsegments * JLBUN_GC_SEGMENT_SIZE;
+    pthread_mutex_unlock(&s->lock);
+  }
   return cap;
 }
 
-// Check if initialized (thread-safe)
-int jlbun_gc_is_initialized(void) {
-  pthread_mutex_lock(&gc_stack.lock);
-  int init = gc_stack.initialized;
-  pthread_mutex_unlock(&gc_stack.lock);
-  return init;
+// Number of slots per segment
+size_t jlbun_gc_segment_size(void) { return JLBUN_GC_SEGMENT_SIZE; }
+
+// Set how long (ms) a segment must stay empty before it is released
+void jlbun_gc_set_idle_threshold(uint64_t ms) {
+  __atomic_store_n(&gc_stack.idle_ns, ms * 1000000ull, __ATOMIC_RELAXED);
+}
+
+uint64_t jlbun_gc_get_idle_threshold(void) {
+  return __atomic_load_n(&gc_stack.idle_ns, __ATOMIC_RELAXED) / 1000000ull;
+}
+
+// Release every empty segment beyond the per-shard spare, regardless of how
+// long it has been idle. Returns the number of released segments.
+size_t jlbun_gc_trim(void) {
+  if (!gc_is_initialized())
+    return 0;
+
+  size_t released = 0;
+  uint64_t now = gc_now_ns();
+  for (int i = 0; i < JLBUN_GC_SHARDS; i++) {
+    JlbunGCShard *s = &gc_stack.shards[i];
+    shard_lock(s);
+    if (s->segments != NULL)
+      released += shard_trim_locked(s, now, 0);
+    shard_unlock(s);
+  }
+  return released;
+}
+
+// Number of root storage shards
+size_t jlbun_gc_shard_count(void) { return JLBUN_GC_SHARDS; }
+
+// Shard that owns a scope's slots
+size_t jlbun_gc_scope_shard(uint64_t scope_id) {
+  return gc_scope_shard(scope_id);
 }
 
+// Write per-shard counters to `out`, JLBUN_GC_SHARD_STATS_FIELDS values per
+// shard: lock acquisitions, contended acquisitions, live slots, capacity.
+// `out` must hold jlbun_gc_shard_count() * JLBUN_GC_SHARD_STATS_FIELDS values.
+void jlbun_gc_shard_stats(uint64_t *out) {
+  for (int i = 0; i < JLBUN_GC_SHARDS; i++) {
+    JlbunGCShard *s = &gc_stack.shards[i];
+    uint64_t *row = out + (size_t)i * JLBUN_GC_SHARD_STATS_FIELDS;
+    if (!gc_is_initialized()) {
+      memset(row, 0, JLBUN_GC_SHARD_STATS_FIELDS * sizeof(uint64_t));
+      continue;
+    }
+    // Plain lock: reading the counters should not change them
+    pthread_mutex_lock(&s->lock);
+    row[0] = s->acquisitions;
+    row[1] = s->contentions;
+    row[2] = s->live;
+    row[3] = s->nsegments * JLBUN_GC_SEGMENT_SIZE;
+    pthread_mutex_unlock(&s->lock);
+  }
+}
+
+// Check if initialized (thread-safe)
+int jlbun_gc_is_initialized(void) { return gc_is_initialized(); }
+
 // Cleanup (called at Julia.close())
 void jlbun_gc_close(void) {
   pthread_mutex_lock(&gc_stack.lock);
 
-  // Free C array for scope IDs
-  if (gc_stack.scope_ids) {
-    free(gc_stack.scope_ids);
-    gc_stack.scope_ids = NULL;
+  if (!gc_is_initialized()) {
+    pthread_mutex_unlock(&gc_stack.lock);
+    return;
   }
 
-  gc_stack.values = NULL;
-  gc_stack.top = 0;
-  gc_stack.capacity = 0;
-  gc_stack.next_scope_id = 1;
-  gc_stack.initialized = 0;
+  __atomic_store_n(&gc_stack.initialized, 0, __ATOMIC_RELEASE);
+  for (int i = 0; i < JLBUN_GC_SHARDS; i++) {
+    JlbunGCShard *s = &gc_stack.shards[i];
+    pthread_mutex_lock(&s->lock);
+    // Free segments and C-side metadata
+    shard_free_metadata(s);
+    pthread_mutex_unlock(&s->lock);
+  }
+  gc_stack.roots = NULL;
+  __atomic_store_n(&gc_stack.next_scope_id, 1, __ATOMIC_RELAXED);
 
   pthread_mutex_unlock(&gc_stack.lock);
 }
@@ -1157,20 +3033,26 @@ void jlbun_gc_close(void) {
  *   - jlbun_gc_perf_init(capacity): Initialize perf mode stack
  *   - jlbun_gc_perf_mark(): Get current stack position (O(1))
  *   - jlbun_gc_perf_push(v): Push value onto stack (O(1))
+ *   - jlbun_gc_perf_push_many(ptrs, n): Push n values to consecutive slots
  *   - jlbun_gc_perf_release(mark): Release to mark position (O(1))
  *   - jlbun_gc_perf_size(): Current stack size
  *   - jlbun_gc_perf_close(): Cleanup
+ *   - jlbun_gc_stats(out): Counters of both stacks (see GC Telemetry below)
  * ============================================================================
  */
 
 typedef struct {
-  jl_array_t *values; // Vector{Any} as root storage
-  size_t top;         // Current stack top (next write position)
-  size_t capacity;    // Current capacity
-  int initialized;    // Initialization flag
+  jl_array_t *values;  // Vector{Any} as root storage
+  size_t top;          // Current stack top (next write position)
+  size_t capacity;     // Current capacity
+  int initialized;     // Initialization flag
+  uint64_t pushes;     // Values pushed
+  uint64_t releases;   // Slots released
+  uint64_t high_water; // Peak stack size
+  uint64_t resizes;    // Capacity growth events
 } JlbunPerfGCStack;
 
-static JlbunPerfGCStack perf_gc_stack = {NULL, 0, 0, 0};
+static JlbunPerfGCStack perf_gc_stack = {NULL, 0, 0, 0, 0, 0, 0, 0};
 
 // Ensure capacity (internal helper, NO LOCKS)
 static int perf_ensure_capacity(size_t needed) {
@@ -1202,6 +3084,7 @@ static int perf_ensure_capacity(size_t needed) {
   }
 
   perf_gc_stack.capacity = new_cap;
+  perf_gc_stack.resizes++;
   return 1;
 }
 
@@ -1217,6 +3100,10 @@ void jlbun_gc_perf_init(size_t initial_capacity) {
 
   perf_gc_stack.capacity = initial_capacity;
   perf_gc_stack.top = 0;
+  perf_gc_stack.pushes = 0;
+  perf_gc_stack.releases = 0;
+  perf_gc_stack.high_water = 0;
+  perf_gc_stack.resizes = 0;
 
   // Create global reference to prevent GC
   char eval_buf[256];
@@ -1251,10 +3138,33 @@ size_t jlbun_gc_perf_push(jl_value_t *v) {
   }
   size_t idx = perf_gc_stack.top++;
   jl_array_ptr_set(perf_gc_stack.values, idx, v);
+  perf_gc_stack.pushes++;
+  if (perf_gc_stack.top > perf_gc_stack.high_water)
+    perf_gc_stack.high_water = perf_gc_stack.top;
   JL_GC_POP();
   return idx;
 }
 
+// Push n values onto the stack. They occupy the consecutive slots starting
+// at the returned index, or SIZE_MAX on error (nothing is pushed). The values
+// must be kept alive by the caller until the call returns.
+size_t jlbun_gc_perf_push_many(jl_value_t **ptrs, size_t n) {
+  if (!perf_gc_stack.initialized)
+    return SIZE_MAX;
+
+  if (!perf_ensure_capacity(perf_gc_stack.top + n))
+    return SIZE_MAX;
+  size_t first = perf_gc_stack.top;
+  for (size_t i = 0; i < n; i++) {
+    jl_array_ptr_set(perf_gc_stack.values, first + i, ptrs[i]);
+  }
+  perf_gc_stack.top += n;
+  perf_gc_stack.pushes += n;
+  if (perf_gc_stack.top > perf_gc_stack.high_water)
+    perf_gc_stack.high_water = perf_gc_stack.top;
+  return first;
+}
+
 // Release all values from mark position to current top
 void jlbun_gc_perf_release(size_t mark) {
   if (!perf_gc_stack.initialized || mark > perf_gc_stack.top)
@@ -1266,6 +3176,7 @@ void jlbun_gc_perf_release(size_t mark) {
   }
 
   // Reset top to mark position
+  perf_gc_stack.releases += perf_gc_stack.top - mark;
   perf_gc_stack.top = mark;
 }
 
@@ -1285,3 +3196,736 @@ void jlbun_gc_perf_close(void) {
   perf_gc_stack.capacity = 0;
   perf_gc_stack.initialized = 0;
 }
+
+/* ============================================================================
+ * GC Telemetry
+ *
+ * jlbun_gc_stats() reads the counters of both root stacks into one struct in
+ * a single call. Counters are cumulative since the stack was initialized;
+ * callers compute rates from the difference of two reads.
+ * ============================================================================
+ */
+
+typedef struct {
+  // Scoped root stack (summed over shards)
+  uint64_t pushes;           // Values rooted
+  uint64_t releases;         // Slots freed by release and scope end
+  uint64_t transfers;        // Values moved to another scope
+  uint64_t escapes;          // Transfers to the global scope (0)
+  uint64_t scope_ends;       // Scopes ended
+  uint64_t slots_scanned;    // Slots visited by scope ends
+  uint64_t max_scope_slots;  // Most slots visited by one scope end
+  uint64_t live;             // Occupied slots
+  uint64_t high_water;       // Sum of the per-shard peaks of live slots
+  uint64_t capacity;         // Slots held by allocated segments
+  uint64_t fragmentation;    // Free slots in partially used segments
+  uint64_t segment_grows;    // Segments added after initialization
+  uint64_t segment_trims;    // Idle segments released
+  uint64_t lock_acquisitions;
+  uint64_t lock_contentions;
+  uint64_t lock_wait_ns;     // Time spent waiting for shard locks
+  // Perf root stack
+  uint64_t perf_pushes;
+  uint64_t perf_releases;
+  uint64_t perf_size;
+  uint64_t perf_high_water;
+  uint64_t perf_capacity;
+  uint64_t perf_resizes;
+} JlbunGCStats;
+
+_Static_assert(sizeof(JlbunGCStats) ==
+                   JLBUN_GC_STATS_FIELDS * sizeof(uint64_t),
+               "JlbunGCStats must be a flat array of uint64_t");
+
+// Fill `out` with the current counters
+void jlbun_gc_stats(JlbunGCStats *out) {
+  memset(out, 0, sizeof(*out));
+
+  if (gc_is_initialized()) {
+    for (int i = 0; i < JLBUN_GC_SHARDS; i++) {
+      JlbunGCShard *s = &gc_stack.shards[i];
+      // Plain lock: reading the counters should not change them
+      pthread_mutex_lock(&s->lock);
+      const JlbunGCCounters *c = &s->counters;
+      out->pushes += c->pushes;
+      out->releases += c->releases;
+      out->transfers += c->transfers;
+      out->escapes += c->escapes;
+      out->scope_ends += c->scope_ends;
+      out->slots_scanned += c->slots_scanned;
+      if (c->max_scope_slots > out->max_scope_slots)
+        out->max_scope_slots = c->max_scope_slots;
+      out->live += s->live;
+      out->high_water += c->high_water;
+      out->capacity += s->nsegments * JLBUN_GC_SEGMENT_SIZE;
+      out->fragmentation +=
+          (s->nsegments - s->empty_segments) * JLBUN_GC_SEGMENT_SIZE - s->live;
+      out->segment_grows += c->grows;
+      out->segment_trims += c->trims;
+      out->lock_acquisitions += s->acquisitions;
+      out->lock_contentions += s->contentions;
+      out->lock_wait_ns += c->lock_wait_ns;
+      pthread_mutex_unlock(&s->lock);
+    }
+  }
+
+  if (perf_gc_stack.initialized) {
+    out->perf_pushes = perf_gc_stack.pushes;
+    out->perf_releases = perf_gc_stack.releases;
+    out->perf_size = perf_gc_stack.top;
+    out->perf_high_water = perf_gc_stack.high_water;
+    out->perf_capacity = perf_gc_stack.capacity;
+    out->perf_resizes = perf_gc_stack.resizes;
+  }
+}
+
+/* ============================================================================
+ * Batched Calls
+ *
+ * Runs a sequence of calls recorded on the JS side in a single FFI crossing.
+ * Each call is packed into `ops` as:
+ *
+ *   [func_ref, nargs, arg_ref_0, ..., arg_ref_{nargs-1}]
+ *
+ * A reference r >= 0 names inputs[r] (values already rooted by the caller),
+ * while r < 0 names the result of call (-r - 1) of the same batch, which must
+ * precede the current call.
+ * ============================================================================
+ */
+
+STATIC_INLINE jl_value_t *batch_resolve(int64_t ref, jl_value_t **inputs,
+                                        size_t ninputs, jl_array_t *results,
+                                        size_t current) {
+  if (ref >= 0) {
+    return (size_t)ref < ninputs ? inputs[ref] : NULL;
+  }
+  size_t slot = (size_t)(-(ref + 1));
+  return slot < current ? jl_array_ptr_ref(results, slot) : NULL;
+}
+
+// Execute `ncalls` packed calls and return a Vector{Any} holding every result.
+// The vector keeps intermediate results rooted while later calls run. On
+// success `*failed` is -1; otherwise it is the index of the first failing
+// call, the vector is filled up to that index, and the Julia exception (if
+// any) is left in jl_exception_occurred(). Returns NULL on malformed input.
+jl_value_t *jlbun_call_batch(const int64_t *ops, size_t ops_len,
+                             jl_value_t **inputs, size_t ninputs,
+                             size_t ncalls, int64_t *failed) {
+  *failed = -1;
+
+  // First pass: validate the layout and find the widest call
+  size_t max_args = 0;
+  size_t pos = 0;
+  for (size_t i = 0; i < ncalls; i++) {
+    if (pos + 2 > ops_len || ops[pos + 1] < 0)
+      return NULL;
+    size_t nargs = (size_t)ops[pos + 1];
+    if (pos + 2 + nargs > ops_len)
+      return NULL;
+    if (nargs > max_args)
+      max_args = nargs;
+    pos += 2 + nargs;
+  }
+
+  // roots[0] = results vector, roots[1] = function, roots[2..] = arguments
+  jl_value_t **roots;
+  JL_GC_PUSHARGS(roots, max_args + 2);
+  jl_array_t *results = jl_alloc_vec_any(ncalls);
+  roots[0] = (jl_value_t *)results;
+
+  pos = 0;
+  for (size_t i = 0; i < ncalls; i++) {
+    size_t nargs = (size_t)ops[pos + 1];
+    jl_value_t *f = batch_resolve(ops[pos], inputs, ninputs, results, i);
+    roots[1] = f;
+    int ok = f != NULL;
+    for (size_t j = 0; ok && j < nargs; j++) {
+      roots[j + 2] = batch_resolve(ops[pos + 2 + j], inputs, ninputs, results, i);
+      ok = roots[j + 2] != NULL;
+    }
+    if (!ok) {
+      *failed = (int64_t)i;
+      break;
+    }
+
+    jl_value_t *ret = jl_call(f, roots + 2, (uint32_t)nargs);
+    if (ret == NULL || jl_exception_occurred() != NULL) {
+      *failed = (int64_t)i;
+      break;
+    }
+    jl_array_ptr_set(results, i, ret);
+    pos += 2 + nargs;
+  }
+
+  JL_GC_POP();
+  return (jl_value_t *)results;
+}
+
+/* ============================================================================
+ * Keyword Calls
+ *
+ * Build a NamedTuple and call `Core.kwcall(kwargs, f, args...)` in a single
+ * FFI crossing. The JS side caches one `NamedTuple{names}` type per key set;
+ * the concrete type is derived from the values' types like the constructor
+ * `NamedTuple{names}(values)` does. Since Julia 1.9, `Core.kwfunc(f)` is
+ * `Core.kwcall` for every function, so the kwsorter is looked up once.
+ * ============================================================================
+ */
+
+// NamedTuple{names}(values) for `names_type` = NamedTuple{names}
+jl_value_t *jlbun_namedtuple_new(jl_value_t *names_type, jl_value_t **values,
+                                 size_t n) {
+  jl_value_t *names = jl_tparam0(jl_unwrap_unionall(names_type));
+  jl_value_t **roots;
+  JL_GC_PUSHARGS(roots, n + 1);
+  for (size_t i = 0; i < n; i++)
+    roots[i] = jl_typeof(values[i]);
+  roots[n] = jl_apply_tuple_type_v(roots, n);
+  roots[n] = jl_apply_type2((jl_value_t *)jl_namedtuple_type, names, roots[n]);
+  jl_value_t *nt = jl_new_structv((jl_datatype_t *)roots[n], values, n);
+  JL_GC_POP();
+  return nt;
+}
+
+// Call f(args...; kwargs...). The keyword arguments are `nkw` values for the
+// key set of `names_type`, or, if `names_type` is NULL, the single NamedTuple
+// kwvalues[0]. Returns NULL with the exception in jl_exception_occurred() if
+// the call throws.
+jl_value_t *jlbun_call_kwargs(jl_value_t *names_type, jl_value_t **kwvalues,
+                              size_t nkw, jl_value_t *f, jl_value_t **args,
+                              size_t nargs) {
+  static jl_value_t *kwcall = NULL;
+  if (kwcall == NULL)
+    kwcall = jl_get_global(jl_core_module, jl_symbol("kwcall"));
+
+  // roots[0] = kwargs, roots[1] = function, roots[2..] = arguments
+  jl_value_t **roots;
+  JL_GC_PUSHARGS(roots, nargs + 2);
+  roots[0] = names_type == NULL
+                 ? kwvalues[0]
+                 : jlbun_namedtuple_new(names_type, kwvalues, nkw);
+  roots[1] = f;
+  for (size_t i = 0; i < nargs; i++)
+    roots[i + 2] = args[i];
+  jl_value_t *ret = jl_call(kwcall, roots, (uint32_t)(nargs + 2));
+  JL_GC_POP();
+  return ret;
+}
+
+/* ============================================================================
+ * Bulk Wrapping Helpers
+ *
+ * Collect many values into one Vector{Any} in a single FFI crossing. The JS
+ * side roots the vector, then roots all of its elements with one bulk push
+ * (jlbun_gc_push_scoped_many / jlbun_gc_perf_push_many) instead of one push
+ * per value. Fresh values must be created here rather than boxed one by one
+ * from JS: until the vector holds them, nothing keeps them alive.
+ * ============================================================================
+ */
+
+#define JLBUN_BOX_INT64 0
+#define JLBUN_BOX_FLOAT64 1
+#define JLBUN_BOX_BOOL 2
+
+// Box n JS primitives into a Vector{Any}. kinds[i] selects how payload[i] is
+// read: an Int64, the bits of a Float64, or a Bool (nonzero is true). Returns
+// NULL on an unknown kind.
+jl_value_t *jlbun_box_many(const uint8_t *kinds, const int64_t *payload,
+                           size_t n) {
+  jl_array_t *out = jl_alloc_vec_any(n);
+  JL_GC_PUSH1(&out);
+  for (size_t i = 0; i < n; i++) {
+    jl_value_t *v;
+    switch (kinds[i]) {
+    case JLBUN_BOX_INT64:
+      v = jl_box_int64(payload[i]);
+      break;
+    case JLBUN_BOX_FLOAT64: {
+      double d;
+      memcpy(&d, &payload[i], sizeof(double));
+      v = jl_box_float64(d);
+      break;
+    }
+    case JLBUN_BOX_BOOL:
+      v = jl_box_bool(payload[i] != 0);
+      break;
+    default:
+      JL_GC_POP();
+      return NULL;
+    }
+    jl_array_ptr_set(out, i, v);
+  }
+  JL_GC_POP();
+  return (jl_value_t *)out;
+}
+
+// Collect the elements a[start], ..., a[start + n - 1] (0-based linear
+// indices) into a Vector{Any}, boxing unboxed elements. The caller checks the
+// bounds.
+jl_value_t *jlbun_array_box_range(jl_array_t *a, size_t start, size_t n) {
+  jl_array_t *out = jl_alloc_vec_any(n);
+  JL_GC_PUSH2(&out, &a);
+  for (size_t i = 0; i < n; i++) {
+    jl_array_ptr_set(out, i, jl_array_ptr_ref_wrapper(a, start + i));
+  }
+  JL_GC_POP();
+  return (jl_value_t *)out;
+}
+
+// Collect every field of a value (e.g. the elements of a tuple) into a
+// Vector{Any}
+jl_value_t *jlbun_get_fields(jl_value_t *v) {
+  size_t n = jl_nfields(v);
+  jl_array_t *out = jl_alloc_vec_any(n);
+  JL_GC_PUSH2(&out, &v);
+  for (size_t i = 0; i < n; i++) {
+    jl_array_ptr_set(out, i, jl_get_nth_field(v, i));
+  }
+  JL_GC_POP();
+  return (jl_value_t *)out;
+}
+
+/* ============================================================================
+ * JS Callback Trampolines
+ *
+ * JS callbacks are called from Julia through one trampoline type per FFI
+ * signature: an isbits `struct <: Function` holding the JSCallback's address,
+ * whose call method `ccall`s it. The type and its method are defined and
+ * compiled once per signature; wrapping another callback only allocates an
+ * instance holding the new address.
+ * ============================================================================
+ */
+
+jl_value_t *jlbun_callback_new(jl_datatype_t *trampoline, void *fptr) {
+  return jl_new_bits((jl_value_t *)trampoline, &fptr);
+}
+
+/* ============================================================================
+ * Task Completion Queue
+ *
+ * Lets JS await a Julia task without blocking in `wait`. jlbun_task_watch()
+ * schedules a small non-sticky watcher task that waits for the target and
+ * then calls jlbun_task_notify() with an ID chosen by the caller, from
+ * whichever Julia thread it ran on. The JS side calls jlbun_task_poll() on a
+ * timer: it pumps the libuv loop, yields once so tasks queued on the main
+ * thread can run until they block, and drains the IDs of finished tasks.
+ * ============================================================================
+ */
+
+#define JLBUN_TASK_QUEUE_INITIAL 64
+
+static struct {
+  pthread_mutex_t lock;
+  uint64_t *ids;
+  size_t len;
+  size_t cap;
+  int dropped; // A notification was lost to a failed allocation
+} task_queue = {PTHREAD_MUTEX_INITIALIZER, NULL, 0, 0, 0};
+
+// Watcher factory, rooted by a constant in Main
+static jl_value_t *task_watcher = NULL;
+
+// Record that the task watched under `id` is done. Called by watcher tasks
+// through ccall, on any thread.
+void jlbun_task_notify(uint64_t id) {
+  pthread_mutex_lock(&task_queue.lock);
+  if (task_queue.len == task_queue.cap) {
+    size_t cap =
+        task_queue.cap ? 2 * task_queue.cap : JLBUN_TASK_QUEUE_INITIAL;
+    uint64_t *ids = (uint64_t *)realloc(task_queue.ids, cap * sizeof(*ids));
+    if (ids == NULL) {
+      task_queue.dropped = 1;
+      pthread_mutex_unlock(&task_queue.lock);
+      return;
+    }
+    task_queue.ids = ids;
+    task_queue.cap = cap;
+  }
+  task_queue.ids[task_queue.len++] = id;
+  pthread_mutex_unlock(&task_queue.lock);
+}
+
+// Start watching `task`; jlbun_task_notify(id) is called once it is done,
+// whether it succeeded or failed. Returns NULL with the Julia exception
+// left in jl_exception_occurred() on failure.
+jl_value_t *jlbun_task_watch(jl_value_t *task, uint64_t id) {
+  if (task_watcher == NULL) {
+    jl_eval_string("const __jlbun_task_watcher__ = (t, id, notify) -> begin\n"
+                   "  w = Task() do\n"
+                   "    try\n"
+                   "      wait(t)\n"
+                   "    catch\n"
+                   "    end\n"
+                   "    ccall(notify, Cvoid, (UInt64,), id)\n"
+                   "  end\n"
+                   "  w.sticky = false\n"
+                   "  schedule(w)\n"
+                   "  nothing\n"
+                   "end");
+    if (jl_exception_occurred() != NULL)
+      return NULL;
+    task_watcher =
+        jl_get_global(jl_main_module, jl_symbol("__jlbun_task_watcher__"));
+  }
+
+  jl_value_t *boxed_id = NULL;
+  jl_value_t *notify = NULL;
+  JL_GC_PUSH3(&task, &boxed_id, &notify);
+  boxed_id = jl_box_uint64(id);
+  notify = jl_box_voidpointer((void *)jlbun_task_notify);
+  jl_value_t *ret = jl_call3(task_watcher, task, boxed_id, notify);
+  JL_GC_POP();
+  if (jl_exception_occurred() != NULL)
+    return NULL;
+  return ret;
+}
+
+// Pump the libuv loop and, if `yield` is nonzero, yield once so runnable
+// tasks on the calling (main) thread run until they block or yield. Then move
+// up to `cap` IDs of finished tasks into `out`. Returns the number of IDs,
+// or -1 if a notification was dropped since the last poll: the caller must
+// then check every task it is waiting for.
+int64_t jlbun_task_poll(uint64_t *out, size_t cap, int32_t yield) {
+  jl_process_events();
+  if (yield) {
+    jl_call0(jl_get_function(jl_base_module, "yield"));
+    jl_exception_clear();
+  }
+
+  pthread_mutex_lock(&task_queue.lock);
+  if (task_queue.dropped) {
+    task_queue.dropped = 0;
+    task_queue.len = 0;
+    pthread_mutex_unlock(&task_queue.lock);
+    return -1;
+  }
+  size_t n = task_queue.len < cap ? task_queue.len : cap;
+  if (n > 0) {
+    memcpy(out, task_queue.ids, n * sizeof(uint64_t));
+    memmove(task_queue.ids, task_queue.ids + n,
+            (task_queue.len - n) * sizeof(uint64_t));
+    task_queue.len -= n;
+  }
+  pthread_mutex_unlock(&task_queue.lock);
+  return (int64_t)n;
+}
+
+/* ============================================================================
+ * Async RPC
+ *
+ * Runs calls submitted from JS on a pool of long-running Julia worker tasks,
+ * pinned to threads other than the main one when there are any. Calls and
+ * completions travel through two bounded lock-free rings (Vyukov's MPMC
+ * queue, used single-producer/multi-consumer for submissions and
+ * multi-producer/single-consumer for completions):
+ *
+ *   JS (jlbun_rpc_submit) --slot--> submit ring --> worker (jlbun_rpc_take)
+ *   worker (jlbun_rpc_complete) --slot--> complete ring --> JS (drain)
+ *
+ * A slot indexes two rooted Vector{Any}s: `calls` holds [f, args...] until a
+ * worker takes it, `results` the return value (or exception) until JS has
+ * wrapped it and released the slot. At most `capacity` calls are in flight,
+ * so neither ring can overflow. Idle workers wait on a Threads.Condition;
+ * the submitter only takes its lock when a worker is waiting.
+ *
+ * Submission, draining and release happen on the JS thread only.
+ * ============================================================================
+ */
+
+typedef struct {
+  size_t seq;
+  int64_t value;
+} rpc_cell_t;
+
+typedef struct {
+  rpc_cell_t *cells;
+  size_t mask;
+  _Alignas(64) size_t head; // Next position to dequeue
+  _Alignas(64) size_t tail; // Next position to enqueue
+} rpc_ring_t;
+
+static int rpc_ring_init(rpc_ring_t *r, size_t capacity) {
+  rpc_cell_t *cells = (rpc_cell_t *)malloc(capacity * sizeof(rpc_cell_t));
+  if (cells == NULL)
+    return 0;
+  for (size_t i = 0; i < capacity; i++)
+    cells[i].seq = i;
+  free(r->cells);
+  r->cells = cells;
+  r->mask = capacity - 1;
+  r->head = 0;
+  r->tail = 0;
+  return 1;
+}
+
+static int rpc_ring_push(rpc_ring_t *r, int64_t value) {
+  size_t pos = __atomic_load_n(&r->tail, __ATOMIC_RELAXED);
+  rpc_cell_t *cell;
+  for (;;) {
+    cell = &r->cells[pos & r->mask];
+    size_t seq = __atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE);
+    intptr_t dif = (intptr_t)seq - (intptr_t)pos;
+    if (dif == 0) {
+      if (__atomic_compare_exchange_n(&r->tail, &pos, pos + 1, 1,
+                                      __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        break;
+    } else if (dif < 0) {
+      return 0; // Full
+    } else {
+      pos = __atomic_load_n(&r->tail, __ATOMIC_RELAXED);
+    }
+  }
+  cell->value = value;
+  __atomic_store_n(&cell->seq, pos + 1, __ATOMIC_RELEASE);
+  return 1;
+}
+
+static int rpc_ring_pop(rpc_ring_t *r, int64_t *value) {
+  size_t pos = __atomic_load_n(&r->head, __ATOMIC_RELAXED);
+  rpc_cell_t *cell;
+  for (;;) {
+    cell = &r->cells[pos & r->mask];
+    size_t seq = __atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE);
+    intptr_t dif = (intptr_t)seq - (intptr_t)(pos + 1);
+    if (dif == 0) {
+      if (__atomic_compare_exchange_n(&r->head, &pos, pos + 1, 1,
+                                      __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        break;
+    } else if (dif < 0) {
+      return 0; // Empty
+    } else {
+      pos = __atomic_load_n(&r->head, __ATOMIC_RELAXED);
+    }
+  }
+  *value = cell->value;
+  __atomic_store_n(&cell->seq, pos + r->mask + 1, __ATOMIC_RELEASE);
+  return 1;
+}
+
+static struct {
+  rpc_ring_t submit;
+  rpc_ring_t complete;
+  size_t capacity;
+  int64_t *free_slots; // Stack of unused slots (JS thread only)
+  size_t nfree;
+  jl_array_t *calls;   // Rooted through __jlbun_rpc_state__
+  jl_array_t *results; // Rooted through __jlbun_rpc_state__
+  jl_value_t *wake;    // wake(all::Bool) notifies waiting workers
+  jl_value_t *done;    // Rooted through __jlbun_rpc_state__
+  int64_t generation;  // Workers of older generations exit
+  int64_t waiting;     // Workers waiting on the condition
+  int running;
+} rpc = {0};
+
+// Worker side: the next submitted slot, -1 if there is none, or -2 if the
+// worker's generation was stopped.
+int64_t jlbun_rpc_take(int64_t generation) {
+  if (__atomic_load_n(&rpc.generation, __ATOMIC_ACQUIRE) != generation)
+    return -2;
+  int64_t slot;
+  return rpc_ring_pop(&rpc.submit, &slot) ? slot : -1;
+}
+
+// Worker side: count a worker in (+1) or out (-1) of waiting. A worker
+// counts itself in under the condition's lock before checking the ring one
+// last time, so a submission either sees it waiting or is seen by it.
+void jlbun_rpc_idle(int32_t delta) {
+  __atomic_add_fetch(&rpc.waiting, delta, __ATOMIC_SEQ_CST);
+}
+
+// Worker side: report a finished slot
+void jlbun_rpc_complete(int64_t slot, int32_t failed) {
+  rpc_ring_push(&rpc.complete, slot * 2 + (failed != 0));
+}
+
+// Start `nworkers` worker tasks with room for `capacity` calls in flight
+// (rounded up to a power of two). Returns a Task, rooted until the next
+// start, that finishes when every worker has exited after jlbun_rpc_stop().
+// Returns NULL if the pool is already running, if workers of the previous
+// start have not exited yet, on allocation failure, or with the Julia
+// exception left in jl_exception_occurred().
+jl_value_t *jlbun_rpc_start(size_t capacity, int32_t nworkers) {
+  static jl_value_t *start_fn = NULL;
+  if (rpc.running || nworkers < 1)
+    return NULL;
+  // Stopped workers may still be in the rings, which are reallocated below
+  if (rpc.done != NULL &&
+      jl_call1(jl_get_function(jl_base_module, "istaskdone"), rpc.done) !=
+          jl_true) {
+    jl_exception_clear();
+    return NULL;
+  }
+  if (start_fn == NULL) {
+    jl_eval_string(
+        "const __jlbun_rpc_state__ = Ref{Any}(nothing)\n"
+        "const __jlbun_rpc_start__ = (capacity, nworkers, generation,\n"
+        "                             take, idle, complete) -> begin\n"
+        "  calls = Vector{Any}(nothing, capacity)\n"
+        "  results = Vector{Any}(nothing, capacity)\n"
+        "  cond = Threads.Condition()\n"
+        "  wake = all -> begin\n"
+        "    lock(cond)\n"
+        "    try\n"
+        "      notify(cond; all = all)\n"
+        "    finally\n"
+        "      unlock(cond)\n"
+        "    end\n"
+        "  end\n"
+        "  nthreads = Threads.nthreads()\n"
+        "  workers = map(1:nworkers) do w\n"
+        "    t = Task() do\n"
+        "      while true\n"
+        "        slot = ccall(take, Int64, (Int64,), generation)\n"
+        "        if slot == -1\n"
+        "          lock(cond)\n"
+        "          try\n"
+        "            ccall(idle, Cvoid, (Int32,), 1)\n"
+        "            slot = ccall(take, Int64, (Int64,), generation)\n"
+        "            slot == -1 && wait(cond)\n"
+        "            ccall(idle, Cvoid, (Int32,), -1)\n"
+        "          finally\n"
+        "            unlock(cond)\n"
+        "          end\n"
+        "          slot == -1 && continue\n"
+        "        end\n"
+        "        slot == -2 && break\n"
+        "        call = calls[slot + 1]::Vector{Any}\n"
+        "        calls[slot + 1] = nothing\n"
+        "        failed = false\n"
+        "        try\n"
+        "          results[slot + 1] = call[1](call[2:end]...)\n"
+        "        catch err\n"
+        "          results[slot + 1] = err\n"
+        "          failed = true\n"
+        "        end\n"
+        "        ccall(complete, Cvoid, (Int64, Int32), slot, failed)\n"
+        "      end\n"
+        "    end\n"
+        "    # Keep the main (JS) thread free when there are other threads\n"
+        "    tid = nthreads == 1 ? 0 : (w - 1) % (nthreads - 1) + 1\n"
+        "    t.sticky = true\n"
+        "    ccall(:jl_set_task_tid, Cint, (Any, Cint), t, tid)\n"
+        "    schedule(t)\n"
+        "  end\n"
+        "  done = Threads.@spawn foreach(wait, workers)\n"
+        "  __jlbun_rpc_state__[] = (calls, results, wake, done)\n"
+        "  done\n"
+        "end");
+    if (jl_exception_occurred() != NULL)
+      return NULL;
+    start_fn =
+        jl_get_global(jl_main_module, jl_symbol("__jlbun_rpc_start__"));
+  }
+
+  size_t cap = 1;
+  while (cap < capacity)
+    cap <<= 1;
+  int64_t *free_slots = (int64_t *)malloc(cap * sizeof(int64_t));
+  if (free_slots == NULL || !rpc_ring_init(&rpc.submit, cap) ||
+      !rpc_ring_init(&rpc.complete, cap)) {
+    free(free_slots);
+    return NULL;
+  }
+  for (size_t i = 0; i < cap; i++)
+    free_slots[i] = (int64_t)(cap - 1 - i);
+  free(rpc.free_slots);
+  rpc.free_slots = free_slots;
+  rpc.nfree = cap;
+  rpc.capacity = cap;
+  rpc.waiting = 0;
+  int64_t generation =
+      __atomic_add_fetch(&rpc.generation, 1, __ATOMIC_ACQ_REL);
+
+  jl_value_t **args;
+  JL_GC_PUSHARGS(args, 6);
+  args[0] = jl_box_uint64(cap);
+  args[1] = jl_box_int64(nworkers);
+  args[2] = jl_box_int64(generation);
+  args[3] = jl_box_voidpointer((void *)jlbun_rpc_take);
+  args[4] = jl_box_voidpointer((void *)jlbun_rpc_idle);
+  args[5] = jl_box_voidpointer((void *)jlbun_rpc_complete);
+  jl_value_t *done = jl_call(start_fn, args, 6);
+  JL_GC_POP();
+  if (done == NULL || jl_exception_occurred() != NULL)
+    return NULL;
+
+  jl_value_t *state = jl_get_nth_field(
+      jl_get_global(jl_main_module, jl_symbol("__jlbun_rpc_state__")), 0);
+  rpc.calls = (jl_array_t *)jl_get_nth_field(state, 0);
+  rpc.results = (jl_array_t *)jl_get_nth_field(state, 1);
+  rpc.wake = jl_get_nth_field(state, 2);
+  rpc.done = done;
+  rpc.running = 1;
+  return done;
+}
+
+// Submit f(args...) to the pool. Returns the slot identifying the call, -1
+// if `capacity` calls are already in flight, or -2 if the pool is not
+// running.
+int64_t jlbun_rpc_submit(jl_value_t *f, jl_value_t **args, size_t nargs) {
+  if (!rpc.running)
+    return -2;
+  if (rpc.nfree == 0)
+    return -1;
+  int64_t slot = rpc.free_slots[--rpc.nfree];
+
+  jl_array_t *call = jl_alloc_vec_any(nargs + 1);
+  JL_GC_PUSH1(&call);
+  jl_array_ptr_set(call, 0, f);
+  for (size_t i = 0; i < nargs; i++)
+    jl_array_ptr_set(call, i + 1, args[i]);
+  jl_array_ptr_set(rpc.calls, (size_t)slot, (jl_value_t *)call);
+  JL_GC_POP();
+
+  rpc_ring_push(&rpc.submit, slot);
+  // Pairs with the seq_cst increment in jlbun_rpc_idle
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  if (__atomic_load_n(&rpc.waiting, __ATOMIC_SEQ_CST) > 0) {
+    jl_call1(rpc.wake, jl_false);
+    jl_exception_clear();
+  }
+  return slot;
+}
+
+// Move up to `cap` finished calls into `slots`, `values` (result or
+// exception, still rooted by the slot) and `failed`. Pumps the libuv loop
+// first and, if `yield` is nonzero, yields once so workers on the main
+// thread can run. Returns the number of finished calls.
+int64_t jlbun_rpc_drain(int64_t *slots, jl_value_t **values, uint8_t *failed,
+                        size_t cap, int32_t yield) {
+  jl_process_events();
+  if (yield) {
+    jl_call0(jl_get_function(jl_base_module, "yield"));
+    jl_exception_clear();
+  }
+  if (!rpc.running)
+    return 0;
+  size_t n = 0;
+  int64_t v;
+  while (n < cap && rpc_ring_pop(&rpc.complete, &v)) {
+    slots[n] = v >> 1;
+    failed[n] = (uint8_t)(v & 1);
+    values[n] = jl_array_ptr_ref(rpc.results, (size_t)(v >> 1));
+    n++;
+  }
+  return (int64_t)n;
+}
+
+// Unroot the results of `n` drained slots and make the slots reusable
+void jlbun_rpc_release(const int64_t *slots, size_t n) {
+  for (size_t i = 0; i < n; i++) {
+    jl_array_ptr_set(rpc.results, (size_t)slots[i], jl_nothing);
+    rpc.free_slots[rpc.nfree++] = slots[i];
+  }
+}
+
+// Tell the workers to exit. Calls still queued are dropped, so the caller
+// waits for every pending call first.
+void jlbun_rpc_stop(void) {
+  if (!rpc.running)
+    return;
+  rpc.running = 0;
+  __atomic_add_fetch(&rpc.generation, 1, __ATOMIC_ACQ_REL);
+  jl_call1(rpc.wake, jl_true);
+  jl_exception_clear();
+}
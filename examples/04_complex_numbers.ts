@@ -12,6 +12,7 @@ import {
   JuliaArray,
   JuliaComplex,
   JuliaFloat64,
+  JuliaFunction,
 } from "../jlbun/index.js";
 
 Julia.init();
@@ -114,6 +115,29 @@ Julia.scope((julia) => {
     const inSet = julia.Main.in_mandelbrot(c).value;
     console.log(`(${re}, ${im}): ${inSet ? "✓ in set" : "✗ escapes"}`);
   }
+
+  // 7. Zero-copy Complex Signals
+  console.log("\n7. Zero-copy Complex Signals");
+  console.log("-".repeat(40));
+
+  // Interleaved [re0, im0, re1, im1, ...], shared with Julia without copying
+  const samples = 1_000_000;
+  const signal = new Float64Array(2 * samples);
+  for (let k = 0; k < samples; k++) {
+    signal[2 * k] = Math.cos((2 * Math.PI * 50 * k) / samples);
+    signal[2 * k + 1] = Math.sin((2 * Math.PI * 50 * k) / samples);
+  }
+  const z = JuliaArray.fromComplex(signal); // Vector{ComplexF64}
+
+  // Rotate every sample by 90° in place, on the Julia side
+  const rotate = julia.eval("z -> (z .*= im; nothing)") as JuliaFunction;
+  rotate(z);
+  console.log(`First sample after rotation: ${signal[0]} + ${signal[1]}im`);
+
+  // Complex results come back as an interleaved view over Julia memory
+  const scaled = julia.Base["*"](z, 2) as JuliaArray;
+  const parts = scaled.value as Float64Array;
+  console.log(`Interleaved parts: ${parts.length} (${scaled.length} samples)`);
 });
 
 Julia.close();
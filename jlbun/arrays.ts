@@ -37,15 +37,371 @@ import {
   JuliaValue,
   MethodError,
 } from "./index.js";
+import { setJuliaExternalOwner } from "./ownership.js";
 
 export interface FromBunArrayOptions {
   juliaGC: boolean;
+  /**
+   * Shape of the array. The product of the dimensions must equal the length
+   * of the `TypedArray`. Defaults to a vector.
+   */
+  shape?: number[];
+  /**
+   * Interpret `shape` in row-major (C) order. The buffer is still shared:
+   * the result is a `PermutedDimsArray` view of shape `shape` over the
+   * column-major array of the reversed shape.
+   */
+  rowMajor?: boolean;
 }
 
 const DEFAULT_FROM_BUN_ARRAY_OPTIONS: FromBunArrayOptions = {
   juliaGC: false,
 };
 
+// Number of elements wrapped per FFI crossing when iterating an array
+const ITERATOR_CHUNK = 128;
+
+/**
+ * Options of `JuliaArray.readInto()` and `JuliaArray.writeFrom()`.
+ */
+export interface BulkAccessOptions {
+  /** First array element (0-based linear index). Defaults to 0. */
+  offset?: number;
+  /**
+   * Number of elements. Defaults to as many as both the array (from
+   * `offset`) and the `TypedArray` hold.
+   */
+  count?: number;
+  /**
+   * Validity bitmap with one bit per element, least significant bit first
+   * (as in Apache Arrow). `readInto` clears the bits of `missing`/`nothing`
+   * elements; `writeFrom` stores `missing` where a bit is cleared.
+   */
+  validity?: Uint8Array;
+}
+
+/**
+ * Strings packed into one UTF-8 buffer, as in Apache Arrow's string layout:
+ * string `i` is `bytes[offsets[i]]` up to (excluding) `bytes[offsets[i + 1]]`.
+ */
+export interface PackedStrings {
+  bytes: Uint8Array;
+  /** `length + 1` offsets, starting at 0. */
+  offsets: Int32Array | BigInt64Array;
+  /**
+   * Validity bitmap with one bit per string, least significant bit first.
+   * Strings whose bit is cleared are `nothing` (their span is empty).
+   */
+  validity?: Uint8Array;
+}
+
+/**
+ * Options of `packStrings()` and `JuliaArray.toStrings()`.
+ */
+export interface PackStringsOptions {
+  /**
+   * Width of the offsets. `"int32"` (the default) limits the total size to
+   * 2 GiB.
+   */
+  offsets?: "int32" | "int64";
+}
+
+const INT32_OFFSET_LIMIT = 2 ** 31 - 1;
+// `jlbun_strings_to_packed` result when the bytes overflow Int32 offsets
+const OFFSET_OVERFLOW = -(2 ** 63);
+
+/**
+ * Pack strings into one UTF-8 buffer and an offsets array. `null` and
+ * `undefined` entries are empty and cleared in the validity bitmap.
+ *
+ * @param values The strings to pack.
+ * @param options Width of the offsets.
+ * @throws RangeError if the strings do not fit in Int32 offsets.
+ */
+export function packStrings(
+  values: readonly (string | null | undefined)[],
+  options: PackStringsOptions = {},
+): PackedStrings {
+  const n = values.length;
+  const wide = options.offsets === "int64";
+  const offsets = wide ? new BigInt64Array(n + 1) : new Int32Array(n + 1);
+  let validity: Uint8Array | undefined;
+
+  // UTF-8 needs at most 3 bytes per UTF-16 code unit
+  let capacity = 0;
+  for (const value of values) {
+    capacity += typeof value === "string" ? value.length * 3 : 0;
+  }
+  const bytes = new Uint8Array(capacity);
+  let pos = 0;
+  for (let i = 0; i < n; i++) {
+    const value = values[i];
+    if (typeof value === "string") {
+      pos += utf8Encoder.encodeInto(value, bytes.subarray(pos)).written;
+    } else {
+      validity ??= new Uint8Array(Math.ceil(n / 8)).fill(0xff);
+      validity[i >> 3] &= ~(1 << (i & 7));
+    }
+    if (wide) {
+      offsets[i + 1] = BigInt(pos);
+    } else if (pos > INT32_OFFSET_LIMIT) {
+      throw new RangeError(
+        'Strings exceed 2 GiB, use { offsets: "int64" } to pack them',
+      );
+    } else {
+      offsets[i + 1] = pos;
+    }
+  }
+  return { bytes: bytes.subarray(0, pos), offsets, validity };
+}
+
+/**
+ * Decode packed strings, with `null` for entries cleared in the validity
+ * bitmap.
+ *
+ * @param packed The packed strings.
+ */
+export function unpackStrings({
+  bytes,
+  offsets,
+  validity,
+}: PackedStrings): (string | null)[] {
+  const n = offsets.length - 1;
+  const result: (string | null)[] = new Array(n);
+  let start = Number(offsets[0]);
+  for (let i = 0; i < n; i++) {
+    const end = Number(offsets[i + 1]);
+    result[i] =
+      validity && !((validity[i >> 3] >> (i & 7)) & 1)
+        ? null
+        : utf8Decoder.decode(bytes.subarray(start, end));
+    start = end;
+  }
+  return result;
+}
+
+// Element kinds of `jlbun_vector_from_packed`
+const PACKED_INT64 = 0;
+const PACKED_FLOAT64 = 1;
+const PACKED_BOOL = 2;
+const PACKED_STRING = 3;
+// Any JS number or in-range bigint, before settling on Int64 or Float64
+const PACKED_NUMBER = -2;
+
+const INT64_LIMIT = 2 ** 63;
+
+const utf8Encoder = new TextEncoder();
+const utf8Decoder = new TextDecoder();
+
+/**
+ * Narrowest packed element kind holding every value, or `null` if the
+ * values need a `Vector{Any}`. `null` and `undefined` become `nothing`.
+ */
+function inferPackedKind(
+  values: unknown[],
+): { kind: number; nullable: boolean } | null {
+  let kind = -1;
+  let nullable = false;
+  let integral = true;
+  let bigints = false;
+  for (const value of values) {
+    let k: number;
+    switch (typeof value) {
+      case "number":
+        k = PACKED_NUMBER;
+        if (!Number.isInteger(value) || Math.abs(value) >= INT64_LIMIT) {
+          integral = false;
+        }
+        break;
+      case "bigint":
+        if (BigInt.asIntN(64, value) !== value) {
+          return null;
+        }
+        k = PACKED_NUMBER;
+        bigints = true;
+        break;
+      case "boolean":
+        k = PACKED_BOOL;
+        break;
+      case "string":
+        k = PACKED_STRING;
+        break;
+      case "undefined":
+        nullable = true;
+        continue;
+      default:
+        if (value === null) {
+          nullable = true;
+          continue;
+        }
+        return null;
+    }
+    if (kind === -1) {
+      kind = k;
+    } else if (kind !== k) {
+      return null;
+    }
+  }
+
+  if (kind === PACKED_NUMBER) {
+    if (integral) {
+      kind = PACKED_INT64;
+    } else if (bigints) {
+      // Fractional numbers and bigints have no common concrete type
+      return null;
+    } else {
+      kind = PACKED_FLOAT64;
+    }
+  }
+  return kind === -1 ? null : { kind, nullable };
+}
+
+/**
+ * Build a concretely typed, unrooted `Vector` from homogeneous JS values in
+ * one FFI call, or return `null` if the values are mixed.
+ */
+function unsafePackHomogeneous(values: unknown[]): Pointer | null {
+  const inferred = inferPackedKind(values);
+  if (inferred === null) {
+    return null;
+  }
+  const { kind, nullable } = inferred;
+  const n = values.length;
+
+  let validity: Uint8Array | null = null;
+  if (nullable) {
+    validity = new Uint8Array(Math.ceil(n / 8));
+    for (let i = 0; i < n; i++) {
+      if (values[i] !== null && values[i] !== undefined) {
+        validity[i >> 3] |= 1 << (i & 7);
+      }
+    }
+  }
+
+  let data: BunArray;
+  let offsets: BigInt64Array | null = null;
+  if (kind === PACKED_STRING) {
+    const packed = packStrings(values as (string | null)[], {
+      offsets: "int64",
+    });
+    data = packed.bytes;
+    offsets = packed.offsets as BigInt64Array;
+  } else if (kind === PACKED_BOOL) {
+    data = Uint8Array.from(values, (value) => (value ? 1 : 0));
+  } else if (kind === PACKED_INT64) {
+    data = BigInt64Array.from(values, (value) =>
+      typeof value === "number" || typeof value === "bigint"
+        ? BigInt(value)
+        : 0n,
+    );
+  } else {
+    data = Float64Array.from(values, (value) =>
+      typeof value === "number" ? value : 0,
+    );
+  }
+
+  return jlbun.symbols.jlbun_vector_from_packed(
+    kind,
+    data.byteLength > 0 ? data : null,
+    offsets,
+    validity,
+    n,
+  );
+}
+
+export type TypedArrayConstructor = {
+  new (buffer: ArrayBuffer): BunArray;
+  new (length: number): BunArray;
+  BYTES_PER_ELEMENT: number;
+};
+
+// `Float16Array` constructor, where the runtime provides one
+const Float16ArrayConstructor = (
+  globalThis as unknown as { Float16Array?: TypedArrayConstructor }
+).Float16Array;
+
+/**
+ * `TypedArray` constructor holding elements of a Julia type, or `null` if
+ * there is none.
+ *
+ * @internal
+ */
+export function typedArrayConstructor(
+  elType: JuliaDataType,
+): TypedArrayConstructor | null {
+  const constructors: [JuliaDataType, TypedArrayConstructor][] = [
+    [Julia.Float64, Float64Array],
+    [Julia.Float32, Float32Array],
+    [Julia.Int64, BigInt64Array],
+    [Julia.UInt64, BigUint64Array],
+    [Julia.Int32, Int32Array],
+    [Julia.UInt32, Uint32Array],
+    [Julia.Int16, Int16Array],
+    [Julia.UInt16, Uint16Array],
+    [Julia.Int8, Int8Array],
+    [Julia.UInt8, Uint8Array],
+  ];
+  if (Float16ArrayConstructor !== undefined) {
+    constructors.push([Julia.Float16, Float16ArrayConstructor]);
+  }
+  for (const [type, ctor] of constructors) {
+    if (elType.isEqual(type)) {
+      return ctor;
+    }
+  }
+  return null;
+}
+
+let complexParts: [Pointer, TypedArrayConstructor][] | null = null;
+
+// `TypedArray` constructor of the parts of a complex element type, or `null`
+function complexPartsConstructor(
+  elType: JuliaDataType,
+): TypedArrayConstructor | null {
+  complexParts ??= [
+    [jlbun.symbols.jl_complexf64_type_getter()!, Float64Array],
+    [jlbun.symbols.jl_complexf32_type_getter()!, Float32Array],
+    [jlbun.symbols.jl_complexf16_type_getter()!, Uint16Array],
+  ];
+  for (const [typePtr, ctor] of complexParts) {
+    if (elType.ptr === typePtr) {
+      return ctor;
+    }
+  }
+  return null;
+}
+
+// Julia element type of a TypedArray
+function bunArrayElType(arr: BunArray): JuliaDataType {
+  if (arr instanceof Int8Array) {
+    return Julia.Int8;
+  } else if (arr instanceof Uint8Array || arr instanceof Uint8ClampedArray) {
+    return Julia.UInt8;
+  } else if (arr instanceof Int16Array) {
+    return Julia.Int16;
+  } else if (arr instanceof Uint16Array) {
+    return Julia.UInt16;
+  } else if (arr instanceof Int32Array) {
+    return Julia.Int32;
+  } else if (arr instanceof Uint32Array) {
+    return Julia.UInt32;
+  } else if (arr instanceof Float32Array) {
+    return Julia.Float32;
+  } else if (arr instanceof Float64Array) {
+    return Julia.Float64;
+  } else if (arr instanceof BigInt64Array) {
+    return Julia.Int64;
+  } else if (arr instanceof BigUint64Array) {
+    return Julia.UInt64;
+  } else if (
+    Float16ArrayConstructor !== undefined &&
+    arr instanceof Float16ArrayConstructor
+  ) {
+    return Julia.Float16;
+  }
+  throw new MethodError("Unsupported TypedArray type.");
+}
+
 /**
  * Wrapper for Julia `Array`.
  *
@@ -168,76 +524,295 @@ export class JuliaArray implements JuliaValue {
 
   /**
    * Create a `JuliaArray` from a `BunArray` (`TypedArray | BigInt64Array | BigUint64Array`).
+   * The Julia array shares the buffer of `arr`, without copying.
    *
    * @param arr
-   * @param extraOptions
+   * @param extraOptions Pass `shape` to get an N-D array, and `rowMajor` to
+   * get a `PermutedDimsArray` view of a row-major buffer.
+   *
+   * @example
+   * ```typescript
+   * // 2x3 column-major matrix
+   * const m = JuliaArray.from(new Float64Array(6), { shape: [2, 3] });
+   * // Row-major 480x640x3 image, indexed as img[y, x, c] on the Julia side
+   * const img = JuliaArray.from(pixels, { shape: [480, 640, 3], rowMajor: true });
+   * ```
    */
+  static from(
+    arr: BunArray,
+    extraOptions: Partial<FromBunArrayOptions> & { rowMajor: true },
+  ): JuliaValue;
+  static from(
+    arr: BunArray,
+    extraOptions?: Partial<FromBunArrayOptions>,
+  ): JuliaArray;
   static from(
     arr: BunArray,
     extraOptions: Partial<FromBunArrayOptions> = {},
-  ): JuliaArray {
+  ): JuliaValue {
     return Julia.adoptValue(JuliaArray.unsafeFrom(arr, extraOptions));
   }
 
+  static unsafeFrom(
+    arr: BunArray,
+    extraOptions: Partial<FromBunArrayOptions> & { rowMajor: true },
+  ): JuliaValue;
+  static unsafeFrom(
+    arr: BunArray,
+    extraOptions?: Partial<FromBunArrayOptions>,
+  ): JuliaArray;
   static unsafeFrom(
     arr: BunArray,
     extraOptions: Partial<FromBunArrayOptions> = {},
+  ): JuliaValue {
+    return JuliaArray.unsafeShare(
+      arr,
+      bunArrayElType(arr),
+      arr.length,
+      extraOptions,
+    );
+  }
+
+  /**
+   * Create a complex `JuliaArray` sharing an interleaved buffer
+   * `[re0, im0, re1, im1, ...]`, without copying: a `Float64Array` gives
+   * `ComplexF64` elements, a `Float32Array` `ComplexF32`, and a `Uint16Array`
+   * of IEEE 754 half-precision bits `ComplexF16`.
+   *
+   * @param data Interleaved real and imaginary parts.
+   * @param extraOptions `shape` counts complex elements.
+   * @throws RangeError if `data` has an odd length or does not match `shape`.
+   *
+   * @example
+   * ```typescript
+   * const samples = new Float64Array(2 * n); // [re0, im0, re1, im1, ...]
+   * const signal = JuliaArray.fromComplex(samples); // Vector{ComplexF64}
+   * ```
+   */
+  static fromComplex(
+    data: Float64Array | Float32Array | Uint16Array,
+    extraOptions: Partial<Omit<FromBunArrayOptions, "rowMajor">> = {},
+  ): JuliaArray {
+    return Julia.adoptValue(JuliaArray.unsafeFromComplex(data, extraOptions));
+  }
+
+  static unsafeFromComplex(
+    data: Float64Array | Float32Array | Uint16Array,
+    extraOptions: Partial<Omit<FromBunArrayOptions, "rowMajor">> = {},
   ): JuliaArray {
+    if (data.length % 2 !== 0) {
+      throw new RangeError(
+        `Interleaved complex data needs an even length, got ${data.length}`,
+      );
+    }
+    let typePtr: Pointer;
+    let typeStr: string;
+    if (data instanceof Float64Array) {
+      typePtr = jlbun.symbols.jl_complexf64_type_getter()!;
+      typeStr = "ComplexF64";
+    } else if (data instanceof Float32Array) {
+      typePtr = jlbun.symbols.jl_complexf32_type_getter()!;
+      typeStr = "ComplexF32";
+    } else {
+      typePtr = jlbun.symbols.jl_complexf16_type_getter()!;
+      typeStr = "ComplexF16";
+    }
+    return JuliaArray.unsafeShare(
+      data,
+      new JuliaDataType(typePtr, typeStr),
+      data.length / 2,
+      extraOptions,
+    ) as JuliaArray;
+  }
+
+  /**
+   * Create a Julia `Float16` array from single precision values in one FFI
+   * call, rounding to nearest even like `Float16.(x)`. The conversion uses
+   * F16C (x86-64) or NEON (AArch64) vector instructions where available.
+   *
+   * @param data The values to narrow.
+   * @param dims Dimensions of the result. Defaults to `data.length`.
+   * @throws RangeError if `dims` are not non-negative integers or do not
+   *   match the length of `data`.
+   *
+   * @example
+   * ```typescript
+   * const w = JuliaArray.fromFloat32AsFloat16(new Float32Array([0.1, 2]));
+   * w.toFloat32(); // Float32Array [0.0999755859375, 2]
+   * ```
+   */
+  static fromFloat32AsFloat16(
+    data: Float32Array,
+    ...dims: number[]
+  ): JuliaArray {
+    return Julia.adoptValue(
+      JuliaArray.unsafeFromFloat32AsFloat16(data, ...dims),
+    );
+  }
+
+  static unsafeFromFloat32AsFloat16(
+    data: Float32Array,
+    ...dims: number[]
+  ): JuliaArray {
+    const shape = dims.length > 0 ? dims : [data.length];
+    if (
+      !shape.every((d) => Number.isSafeInteger(d) && d >= 0) ||
+      shape.reduce((a, b) => a * b, 1) !== data.length
+    ) {
+      throw new RangeError(
+        `Shape [${shape}] does not match the array length ${data.length}`,
+      );
+    }
+    const arr = JuliaArray.unsafeInit(Julia.Float16, ...shape);
+    if (data.length > 0) {
+      jlbun.symbols.jlbun_f32_to_f16(data, arr.rawPtr, data.length);
+    }
+    return arr;
+  }
+
+  // Share the buffer of `arr` as a Julia array of `length` elements
+  private static unsafeShare(
+    arr: BunArray,
+    elType: JuliaDataType,
+    length: number,
+    extraOptions: Partial<FromBunArrayOptions>,
+  ): JuliaValue {
     const options = { ...DEFAULT_FROM_BUN_ARRAY_OPTIONS, ...extraOptions };
-    const rawPtr = ptr(arr.buffer);
+    const rawPtr = ptr(arr.buffer, arr.byteOffset);
     const juliaGC = options.juliaGC ? 1 : 0;
-    let elType: JuliaDataType;
-    if (arr instanceof Int8Array) {
-      elType = Julia.Int8;
-    } else if (arr instanceof Uint8Array || arr instanceof Uint8ClampedArray) {
-      elType = Julia.UInt8;
-    } else if (arr instanceof Int16Array) {
-      elType = Julia.Int16;
-    } else if (arr instanceof Uint16Array) {
-      elType = Julia.UInt16;
-    } else if (arr instanceof Int32Array) {
-      elType = Julia.Int32;
-    } else if (arr instanceof Uint32Array) {
-      elType = Julia.UInt32;
-    } else if (arr instanceof Float32Array) {
-      elType = Julia.Float32;
-    } else if (arr instanceof Float64Array) {
-      elType = Julia.Float64;
-    } else if (arr instanceof BigInt64Array) {
-      elType = Julia.Int64;
-    } else if (arr instanceof BigUint64Array) {
-      elType = Julia.UInt64;
-    } else {
-      throw new MethodError("Unsupported TypedArray type.");
+
+    const shape = options.shape ?? [length];
+    if (
+      shape.length === 0 ||
+      !shape.every((d) => Number.isSafeInteger(d) && d >= 0) ||
+      shape.reduce((a, b) => a * b, 1) !== length
+    ) {
+      throw new RangeError(
+        `Shape [${shape}] does not match the array length ${length}`,
+      );
     }
 
-    const arrType = jlbun.symbols.jl_apply_array_type(elType.ptr, 1)!;
-    return new JuliaArray(
-      jlbun.symbols.jl_ptr_to_array_1d(arrType, rawPtr, arr.length, juliaGC)!,
-      elType,
-      arr,
+    const ndims = shape.length;
+    const arrType = jlbun.symbols.jl_apply_array_type(elType.ptr, ndims)!;
+    if (ndims === 1) {
+      return new JuliaArray(
+        jlbun.symbols.jl_ptr_to_array_1d(arrType, rawPtr, length, juliaGC)!,
+        elType,
+        arr,
+      );
+    }
+
+    const rowMajor = options.rowMajor ? 1 : 0;
+    const resultPtr = jlbun.symbols.jlbun_ptr_to_array_nd(
+      arrType,
+      rawPtr,
+      new BigUint64Array(shape.map(BigInt)),
+      ndims,
+      juliaGC,
+      rowMajor,
     );
+    if (resultPtr === null) {
+      throw new Error(`Failed to wrap buffer with shape [${shape}]`);
+    }
+    if (rowMajor) {
+      // The view must keep the shared buffer alive, like a `JuliaArray` does
+      return setJuliaExternalOwner(Julia.unsafe.wrapPtr(resultPtr), arr);
+    }
+    return new JuliaArray(resultPtr, elType, arr);
   }
 
   /**
    * Create a `JuliaArray` from a JS `Array` with arbitrary types.
    *
+   * Homogeneous values get the narrowest concrete element type and are
+   * packed into the Julia array in one FFI call: `Vector{Int64}` for
+   * integers and bigints, `Vector{Float64}` for numbers with fractions,
+   * `Vector{Bool}` and `Vector{String}`. `null` and `undefined` elements
+   * turn the element type into `Union{Nothing, T}`. Mixed values give a
+   * `Vector{Any}`.
+   *
    * @param values
+   *
+   * @example
+   * ```typescript
+   * JuliaArray.fromAny([1, 2, 3]); // Vector{Int64}
+   * JuliaArray.fromAny([1, 2.5]); // Vector{Float64}
+   * JuliaArray.fromAny(["a", null]); // Vector{Union{Nothing, String}}
+   * JuliaArray.fromAny([1, "a"]); // Vector{Any}
+   * ```
    */
   // eslint-disable-next-line @typescript-eslint/no-explicit-any
   static fromAny(values: any[]): JuliaArray {
+    if (values.length > 0) {
+      const packed = unsafePackHomogeneous(values);
+      if (packed !== null) {
+        return Julia.wrapPtr(packed) as JuliaArray;
+      }
+      if (values.every(Julia.isBoxablePrimitive)) {
+        // Box and store every element in one FFI call
+        return Julia.wrapPtr(Julia.unsafeBoxMany(values)) as JuliaArray;
+      }
+    }
     const arr = Julia.adoptValue(JuliaArray.unsafeInit(Julia.Any, 0));
     return JuliaArray.unsafePushAny(arr, values);
   }
 
   // eslint-disable-next-line @typescript-eslint/no-explicit-any
   static unsafeFromAny(values: any[]): JuliaArray {
+    const packed = values.length > 0 ? unsafePackHomogeneous(values) : null;
+    if (packed !== null) {
+      return Julia.unsafe.wrapPtr(packed) as JuliaArray;
+    }
     return JuliaArray.unsafePushAny(
       JuliaArray.unsafeInit(Julia.Any, 0),
       values,
     );
   }
 
+  /**
+   * Create a `Vector{String}` from JS strings or packed UTF-8 strings in one
+   * FFI call. `null` / `undefined` entries, or entries cleared in the
+   * validity bitmap of packed strings, give a
+   * `Vector{Union{Nothing, String}}`.
+   *
+   * @param values The strings, or strings packed by `packStrings()` or
+   * `toStrings()`.
+   *
+   * @example
+   * ```typescript
+   * const tokens = JuliaArray.fromStrings(["the", "quick", "fox"]);
+   * const copy = JuliaArray.fromStrings(tokens.toStrings());
+   * ```
+   */
+  static fromStrings(
+    values: readonly (string | null | undefined)[] | PackedStrings,
+  ): JuliaArray {
+    return Julia.wrapPtr(JuliaArray.unsafePackStrings(values)) as JuliaArray;
+  }
+
+  static unsafeFromStrings(
+    values: readonly (string | null | undefined)[] | PackedStrings,
+  ): JuliaArray {
+    return Julia.unsafe.wrapPtr(
+      JuliaArray.unsafePackStrings(values),
+    ) as JuliaArray;
+  }
+
+  private static unsafePackStrings(
+    values: readonly (string | null | undefined)[] | PackedStrings,
+  ): Pointer {
+    const { bytes, offsets, validity } = Array.isArray(values)
+      ? packStrings(values)
+      : (values as PackedStrings);
+    return jlbun.symbols.jlbun_strings_from_packed(
+      bytes.byteLength > 0 ? bytes : null,
+      offsets,
+      offsets.BYTES_PER_ELEMENT,
+      validity ?? null,
+      offsets.length - 1,
+    )!;
+  }
+
   // eslint-disable-next-line @typescript-eslint/no-explicit-any
   private static unsafePushAny(arr: JuliaArray, values: any[]): JuliaArray {
     const push = Julia.getFunction(Julia.Base, "push!");
@@ -438,6 +1013,224 @@ export class JuliaArray implements JuliaValue {
     this.set(linearIndex, value);
   }
 
+  /**
+   * Copy array elements into a `TypedArray` in one FFI call.
+   *
+   * Arrays with the same element type are copied with `memcpy`, and other
+   * numeric element types are converted: integers are truncated as when
+   * assigning to a `TypedArray`, floats are never converted to integers.
+   * A `Uint8ClampedArray` target is the exception: values of other element
+   * types are clamped to 0..255 and rounded, as when assigning to it.
+   * `Vector{Any}` and `Union{Missing, T}` arrays are unboxed element by
+   * element in C; `missing` and `nothing` are reported through `validity`.
+   *
+   * @param target The destination. Its type selects the conversion.
+   * @param options Range of array elements and an optional validity bitmap.
+   * @returns The number of elements read.
+   * @throws RangeError if the range exceeds the array or `target`.
+   * @throws TypeError if an element is not numeric, or is missing and no
+   * `validity` bitmap was given.
+   *
+   * @example
+   * ```typescript
+   * const arr = Julia.eval("Any[1, 2.5, missing, 4]") as JuliaArray;
+   * const values = new Float64Array(arr.length);
+   * const validity = new Uint8Array(1);
+   * arr.readInto(values, { validity }); // values: [1, 2.5, 0, 4], validity: [0b1011]
+   * ```
+   */
+  readInto(target: BunArray, options: BulkAccessOptions = {}): number {
+    const [offset, count] = this.bulkRange(target, options);
+    if (count === 0) {
+      return 0;
+    }
+    // C truncates integers like a Uint8Array would: read other element types
+    // as Float64 and let the clamped array clamp them
+    const clamp =
+      target instanceof Uint8ClampedArray && !this.elType.isEqual(Julia.UInt8);
+    const buffer = clamp ? new Float64Array(count) : target;
+    const result = Number(
+      jlbun.symbols.jlbun_array_read(
+        this.ptr,
+        offset,
+        count,
+        bunArrayElType(buffer).ptr,
+        buffer,
+        options.validity ?? null,
+      ),
+    );
+    if (result < 0) {
+      throw new TypeError(
+        `Cannot read element ${offset - result - 1} into a ${target.constructor.name}`,
+      );
+    }
+    if (clamp) {
+      target.set(buffer);
+    }
+    return result;
+  }
+
+  /**
+   * Copy elements of a `TypedArray` into the array in one FFI call.
+   *
+   * Arrays with the same element type are filled with `memcpy`, and other
+   * numeric element types are converted as in `readInto()`. `Vector{Any}`
+   * gets freshly boxed values of the `TypedArray`'s element type, and
+   * `Union{Missing, T}` arrays store into `T`.
+   *
+   * @param source The values to write.
+   * @param options Range of array elements, and an optional validity bitmap:
+   * elements whose bit is cleared are written as `missing`.
+   * @returns The number of elements written.
+   * @throws RangeError if the range exceeds the array or `source`.
+   * @throws TypeError if a value cannot be stored in the array. Elements
+   * before the failing one have been written.
+   */
+  writeFrom(source: BunArray, options: BulkAccessOptions = {}): number {
+    const [offset, count] = this.bulkRange(source, options);
+    if (count === 0) {
+      return 0;
+    }
+    const result = Number(
+      jlbun.symbols.jlbun_array_write(
+        this.ptr,
+        offset,
+        count,
+        bunArrayElType(source).ptr,
+        source,
+        options.validity ?? null,
+      ),
+    );
+    if (result < 0) {
+      throw new TypeError(
+        `Cannot store element ${offset - result - 1} from a ${source.constructor.name}`,
+      );
+    }
+    return result;
+  }
+
+  /**
+   * Copy the array into a new `Float32Array` in one FFI call.
+   *
+   * `Float16` elements are widened with F16C (x86-64) or NEON (AArch64)
+   * vector instructions where available. Complex arrays give their
+   * interleaved `[re, im]` parts, and other numeric element types are
+   * converted as in `readInto()`.
+   *
+   * @throws TypeError if an element is not numeric.
+   *
+   * @example
+   * ```typescript
+   * const half = Julia.eval("Float16[0.5, 1, 2]") as JuliaArray;
+   * half.toFloat32(); // Float32Array [0.5, 1, 2]
+   * ```
+   */
+  toFloat32(): Float32Array {
+    const parts = complexPartsConstructor(this.elType);
+    if (parts === Uint16Array) {
+      const out = new Float32Array(2 * this.length);
+      if (out.length > 0) {
+        jlbun.symbols.jlbun_f16_to_f32(this.rawPtr, out, out.length);
+      }
+      return out;
+    } else if (parts !== null) {
+      return Float32Array.from(this.value as Float64Array | Float32Array);
+    }
+    const out = new Float32Array(this.length);
+    this.readInto(out);
+    return out;
+  }
+
+  /**
+   * Serialize a vector of strings into one UTF-8 buffer and an offsets
+   * array, copying the bytes of every string in one FFI call.
+   *
+   * If the array may hold `nothing` or `missing`, the result has a validity
+   * bitmap with their bits cleared. Use `unpackStrings()` to decode, or
+   * `fromStrings()` to build another Julia vector.
+   *
+   * @param options Width of the offsets.
+   * @throws TypeError if an element is not a `String`.
+   * @throws RangeError if the strings do not fit in Int32 offsets.
+   *
+   * @example
+   * ```typescript
+   * const arr = Julia.eval('["a", "bc", nothing]') as JuliaArray;
+   * const { bytes, offsets, validity } = arr.toStrings();
+   * // bytes: "abc", offsets: [0, 1, 3, 3], validity: [0b011]
+   * ```
+   */
+  toStrings(options: PackStringsOptions = {}): PackedStrings {
+    const n = this.length;
+    const wide = options.offsets === "int64";
+    const offsets = wide ? new BigInt64Array(n + 1) : new Int32Array(n + 1);
+    const validity = this.elType.isEqual(Julia.String)
+      ? undefined
+      : new Uint8Array(Math.max(Math.ceil(n / 8), 1));
+
+    // Guess the size first; the offsets tell the exact size if it was short
+    let bytes = new Uint8Array(Math.max(n * 16, 64));
+    let total = this.packStrings(bytes, offsets, validity);
+    if (total > bytes.length) {
+      bytes = new Uint8Array(total);
+      total = this.packStrings(bytes, offsets, validity);
+    }
+    return { bytes: bytes.subarray(0, total), offsets, validity };
+  }
+
+  private packStrings(
+    bytes: Uint8Array,
+    offsets: Int32Array | BigInt64Array,
+    validity: Uint8Array | undefined,
+  ): number {
+    const result = Number(
+      jlbun.symbols.jlbun_strings_to_packed(
+        this.ptr,
+        bytes,
+        bytes.length,
+        offsets,
+        offsets.BYTES_PER_ELEMENT,
+        validity ?? null,
+      ),
+    );
+    if (result === OFFSET_OVERFLOW) {
+      throw new RangeError(
+        'Strings exceed 2 GiB, use { offsets: "int64" } to pack them',
+      );
+    } else if (result < 0) {
+      throw new TypeError(`Element ${-result - 1} is not a String`);
+    }
+    return result;
+  }
+
+  // Validate the range of a bulk read or write
+  private bulkRange(
+    buffer: BunArray,
+    { offset = 0, count, validity }: BulkAccessOptions,
+  ): [number, number] {
+    const length = this.length;
+    if (!Number.isSafeInteger(offset) || offset < 0 || offset > length) {
+      throw new RangeError(`Offset out of bounds: ${offset}`);
+    }
+    const n = count ?? Math.min(length - offset, buffer.length);
+    if (!Number.isSafeInteger(n) || n < 0 || offset + n > length) {
+      throw new RangeError(
+        `Range [${offset}, ${offset + n}) exceeds the array length ${length}`,
+      );
+    }
+    if (n > buffer.length) {
+      throw new RangeError(
+        `${buffer.constructor.name} of length ${buffer.length} is too small for ${n} elements`,
+      );
+    }
+    if (validity !== undefined && validity.length * 8 < n) {
+      throw new RangeError(
+        `Validity bitmap of ${validity.length} bytes is too small for ${n} elements`,
+      );
+    }
+    return [offset, n];
+  }
+
   // eslint-disable-next-line @typescript-eslint/no-explicit-any
   get value(): BunArray | any[] {
     const rawPtr = this.rawPtr;
@@ -462,6 +1255,20 @@ export class JuliaArray implements JuliaValue {
       return new BigInt64Array(toArrayBuffer(rawPtr, 0, 8 * this.length));
     } else if (this.elType.isEqual(Julia.UInt64)) {
       return new BigUint64Array(toArrayBuffer(rawPtr, 0, 8 * this.length));
+    } else if (
+      this.elType.isEqual(Julia.Float16) &&
+      Float16ArrayConstructor !== undefined
+    ) {
+      return new Float16ArrayConstructor(
+        toArrayBuffer(rawPtr, 0, 2 * this.length),
+      );
+    }
+
+    // Complex elements: interleaved [re, im] parts
+    const parts = complexPartsConstructor(this.elType);
+    if (parts !== null) {
+      const bytes = 2 * parts.BYTES_PER_ELEMENT * this.length;
+      return new parts(toArrayBuffer(rawPtr, 0, bytes));
     } else {
       return Array.from({ length: this.length }, (_, i) => this.get(i).value);
     }
@@ -559,8 +1366,11 @@ export class JuliaArray implements JuliaValue {
    */
   *[Symbol.iterator](): Iterator<JuliaValue> {
     const len = this.length;
-    for (let i = 0; i < len; i++) {
-      yield this.get(i);
+    // Elements are fetched and rooted in chunks, one FFI crossing each
+    for (let start = 0; start < len; start += ITERATOR_CHUNK) {
+      const n = Math.min(ITERATOR_CHUNK, len - start);
+      const vec = jlbun.symbols.jlbun_array_box_range(this.ptr, start, n)!;
+      yield* Julia.wrapVector(vec, n);
     }
   }
 
@@ -0,0 +1,138 @@
+import { Julia, jlbun, JuliaValue } from "./index.js";
+
+/**
+ * Reference to the result of a call recorded in a `JuliaBatch`.
+ *
+ * Slots can be passed as arguments (or as the callee) of later calls in the
+ * same batch, so intermediate results never cross back into JS.
+ */
+export class JuliaBatchSlot {
+  constructor(
+    readonly batch: JuliaBatch,
+    readonly index: number,
+  ) {}
+
+  toString(): string {
+    return `<batch slot ${this.index}>`;
+  }
+}
+
+interface BatchCall {
+  func: (JuliaValue & { name?: string }) | JuliaBatchSlot;
+  args: unknown[];
+}
+
+/**
+ * Recorder for `Julia.batch()`.
+ *
+ * Calls are not executed when recorded. Instead, they are packed into a
+ * descriptor buffer and executed together in a single FFI crossing when the
+ * batch callback returns.
+ */
+export class JuliaBatch {
+  private inputs: JuliaValue[] = [];
+  private inputIndex: Map<JuliaValue, number> = new Map();
+  private ops: number[] = [];
+  private calls: BatchCall[] = [];
+  private sealed = false;
+
+  /**
+   * Number of recorded calls.
+   */
+  get length(): number {
+    return this.calls.length;
+  }
+
+  /**
+   * Record a call. Non-`JuliaValue` arguments are wrapped with
+   * `Julia.autoWrap` immediately and rooted in the active scope.
+   *
+   * @param func The Julia function (or a slot holding one) to be called.
+   * @param args Arguments of the call. `JuliaBatchSlot` arguments refer to
+   * the results of earlier calls in this batch.
+   * @returns A slot referring to the result of this call.
+   */
+  call(
+    func: (JuliaValue & { name?: string }) | JuliaBatchSlot,
+    ...args: unknown[]
+  ): JuliaBatchSlot {
+    if (this.sealed) {
+      throw new Error("Cannot record calls in an executed JuliaBatch");
+    }
+    const index = this.calls.length;
+    this.ops.push(this.ref(func), args.length);
+    for (const arg of args) {
+      this.ops.push(this.ref(arg));
+    }
+    this.calls.push({ func, args });
+    return new JuliaBatchSlot(this, index);
+  }
+
+  private ref(value: unknown): number {
+    if (value instanceof JuliaBatchSlot) {
+      if (value.batch !== this) {
+        throw new Error("JuliaBatchSlot belongs to a different JuliaBatch");
+      }
+      return -value.index - 1;
+    }
+    const wrapped = Julia.autoWrap(value);
+    let idx = this.inputIndex.get(wrapped);
+    if (idx === undefined) {
+      idx = this.inputs.length;
+      this.inputs.push(wrapped);
+      this.inputIndex.set(wrapped, idx);
+    }
+    return idx;
+  }
+
+  /**
+   * Execute all recorded calls in one FFI crossing.
+   *
+   * @internal
+   */
+  execute(): JuliaValue[] {
+    this.sealed = true;
+    const ncalls = this.calls.length;
+    if (ncalls === 0) {
+      return [];
+    }
+
+    const ops = BigInt64Array.from(this.ops, BigInt);
+    const inputs = new BigUint64Array(
+      this.inputs.map((value) => BigInt(value.ptr)),
+    );
+    const failed = new BigInt64Array(1);
+    const resultsPtr = jlbun.symbols.jlbun_call_batch(
+      ops,
+      ops.length,
+      inputs,
+      inputs.length,
+      ncalls,
+      failed,
+    );
+    if (resultsPtr === null) {
+      throw new Error("Malformed JuliaBatch descriptor");
+    }
+
+    const failedIdx = Number(failed[0]);
+    if (failedIdx >= 0) {
+      const { func, args } = this.calls[failedIdx];
+      const callee =
+        func instanceof JuliaBatchSlot
+          ? { ptr: resultsPtr, name: func.toString(), value: undefined }
+          : func;
+      try {
+        Julia.handleCallException(callee, args);
+      } catch (err) {
+        if (err instanceof Error) {
+          err.message = `Batch call ${failedIdx}: ${err.message}`;
+        }
+        throw err;
+      }
+      throw new Error(`Invalid slot reference in batch call ${failedIdx}`);
+    }
+
+    // The result vector keeps every result alive while they are rooted
+    return Julia.wrapVector(resultsPtr, ncalls);
+  }
+}
@@ -0,0 +1,63 @@
+/* eslint-disable @typescript-eslint/no-explicit-any */
+import { typedArrayConstructor } from "./arrays.js";
+import {
+  BunArray,
+  Julia,
+  JuliaArray,
+  PackedStrings,
+  unpackStrings,
+} from "./index.js";
+
+/**
+ * A column of keys, values or set elements: a `TypedArray`, strings packed
+ * into one UTF-8 buffer, or a plain JS array.
+ */
+export type JuliaColumn = BunArray | PackedStrings | any[];
+
+/**
+ * Convert a column to a Julia vector in one FFI call. `TypedArray`s are
+ * shared without copying, so the result must not outlive the column.
+ *
+ * @internal
+ */
+export function columnToJulia(column: JuliaColumn): JuliaArray {
+  if (ArrayBuffer.isView(column)) {
+    return JuliaArray.from(column as BunArray);
+  } else if (Array.isArray(column)) {
+    return JuliaArray.fromAny(column);
+  } else {
+    return JuliaArray.fromStrings(column as PackedStrings);
+  }
+}
+
+/**
+ * Copy a Julia vector into a column: a `TypedArray` for numeric element
+ * types, packed strings for `String`, and a plain JS array otherwise.
+ *
+ * @internal
+ */
+export function columnFromJulia(arr: JuliaArray): JuliaColumn {
+  const ctor = typedArrayConstructor(arr.elType);
+  if (ctor !== null) {
+    const column = new ctor(arr.length);
+    arr.readInto(column);
+    return column;
+  } else if (arr.elType.isEqual(Julia.String)) {
+    return arr.toStrings();
+  }
+  return arr.value as any[];
+}
+
+/**
+ * JS values of a column, as `JuliaValue.value` would return them.
+ *
+ * @internal
+ */
+export function columnValues(column: JuliaColumn): any[] {
+  if (ArrayBuffer.isView(column)) {
+    return Array.from(column as BunArray);
+  } else if (Array.isArray(column)) {
+    return column;
+  }
+  return unpackStrings(column as PackedStrings);
+}
@@ -1,6 +1,54 @@
 /* eslint-disable @typescript-eslint/no-explicit-any */
 import { Pointer } from "bun:ffi";
-import { Julia, JuliaNothing, JuliaValue } from "./index.js";
+import {
+  columnFromJulia,
+  columnToJulia,
+  columnValues,
+  JuliaColumn,
+} from "./columns.js";
+import {
+  Julia,
+  JuliaArray,
+  JuliaNothing,
+  JuliaTuple,
+  JuliaValue,
+} from "./index.js";
+import { juliaHelper } from "./utils.js";
+
+/**
+ * Keys and values of a dictionary as columns, in iteration order.
+ */
+export interface JuliaDictColumns {
+  keys: JuliaColumn;
+  values: JuliaColumn;
+}
+
+// Build a `D{K, V}` from key and value vectors in one call
+function dictFromColumns(
+  dictType: JuliaValue,
+  keys: JuliaColumn,
+  values: JuliaColumn,
+): JuliaValue {
+  const build = juliaHelper(
+    "dict_from_columns",
+    `(D, ks, vs) -> begin
+      length(ks) == length(vs) ||
+        throw(DimensionMismatch("keys and values differ in length"))
+      d = D{eltype(ks), eltype(vs)}()
+      sizehint!(d, length(ks))
+      for (k, v) in zip(ks, vs)
+        d[k] = v
+      end
+      d
+    end`,
+  );
+  return Julia.call(
+    build,
+    dictType,
+    columnToJulia(keys),
+    columnToJulia(values),
+  )!;
+}
 
 /**
  * Wrapper for Julia `Dict`.
@@ -22,6 +70,31 @@ export class JuliaDict implements JuliaValue {
     return dict;
   }
 
+  /**
+   * Create a `Dict` from a column of keys and a column of values in O(1)
+   * FFI calls: each column crosses once, and the dictionary is filled by a
+   * single Julia call after `sizehint!`. The key and value types are the
+   * element types of the columns.
+   *
+   * @param keys The keys: a `TypedArray`, packed strings or a JS array.
+   * @param values The values, in the same order.
+   * @throws DimensionMismatch if the columns differ in length.
+   *
+   * @example
+   * ```typescript
+   * const ids = JuliaDict.fromColumns(
+   *   packStrings(["a", "b"]),
+   *   new Int32Array([1, 2]),
+   * ); // Dict{String, Int32}
+   * ```
+   */
+  public static fromColumns(
+    keys: JuliaColumn,
+    values: JuliaColumn,
+  ): JuliaDict {
+    return dictFromColumns(Julia.Base.Dict, keys, values) as JuliaDict;
+  }
+
   has(key: any): boolean {
     return Julia.Base.haskey(this, key).value;
   }
@@ -47,8 +120,35 @@ export class JuliaDict implements JuliaValue {
     return Number(Julia.Base.length(this).value);
   }
 
+  /**
+   * Copy the keys and values into dense columns in one pass over the
+   * dictionary: `TypedArray`s for numeric types, packed strings for
+   * `String`, and JS arrays otherwise.
+   */
+  toColumns(): JuliaDictColumns {
+    const split = juliaHelper(
+      "dict_to_columns",
+      `d -> begin
+        ks = Vector{keytype(d)}(undef, length(d))
+        vs = Vector{valtype(d)}(undef, length(d))
+        for (i, (k, v)) in enumerate(d)
+          @inbounds ks[i] = k
+          @inbounds vs[i] = v
+        end
+        (ks, vs)
+      end`,
+    );
+    const columns = Julia.call(split, this) as JuliaTuple;
+    return {
+      keys: columnFromJulia(columns.get(0) as JuliaArray),
+      values: columnFromJulia(columns.get(1) as JuliaArray),
+    };
+  }
+
   get value(): Map<any, any> {
-    return new Map(Julia.Base.collect(this).value);
+    const { keys, values } = this.toColumns();
+    const vs = columnValues(values);
+    return new Map(columnValues(keys).map((k, i) => [k, vs[i]]));
   }
 
   keys(): any[] {
@@ -83,6 +183,13 @@ export class JuliaIdDict extends JuliaDict {
     return dict;
   }
 
+  public static fromColumns(
+    keys: JuliaColumn,
+    values: JuliaColumn,
+  ): JuliaIdDict {
+    return dictFromColumns(Julia.Base.IdDict, keys, values) as JuliaIdDict;
+  }
+
   toString(): string {
     return `[JuliaIdDict ${Julia.string(this)}]`;
   }
@@ -1,6 +1,57 @@
-import { FFIFunction, JSCallback, Pointer } from "bun:ffi";
-import { Julia, JuliaNamedTuple, JuliaValue } from "./index.js";
-import { mapFFITypeToJulia } from "./utils.js";
+import {
+  CFunction,
+  FFIFunction,
+  FFIType,
+  FFITypeOrString,
+  JSCallback,
+  Pointer,
+  toArrayBuffer,
+} from "bun:ffi";
+import { BunArray, TypedArrayConstructor } from "./arrays.js";
+import {
+  jlbun,
+  Julia,
+  JuliaNamedTuple,
+  JuliaPtr,
+  JuliaValue,
+  safeCString,
+} from "./index.js";
+import { mapFFITypeToJulia, parseFFISignature } from "./utils.js";
+
+/**
+ * Element types of `JuliaFunction.fromVectorized()` callbacks.
+ */
+export interface VectorizedCallbackDefinition {
+  /** Element type of the input buffer. */
+  arg: FFITypeOrString;
+  /** Element type of the output buffer. */
+  returns: FFITypeOrString;
+}
+
+// `TypedArray` views handed to vectorized callbacks, by Julia element type
+const VECTORIZED_ARRAYS: Record<string, TypedArrayConstructor> = {
+  Int8: Int8Array,
+  UInt8: Uint8Array,
+  Int16: Int16Array,
+  UInt16: Uint16Array,
+  Int32: Int32Array,
+  UInt32: Uint32Array,
+  Int64: BigInt64Array,
+  UInt64: BigUint64Array,
+  Float32: Float32Array,
+  Float64: Float64Array,
+};
+
+/**
+ * Native entry point produced by `JuliaFunction.compile()`.
+ */
+// eslint-disable-next-line @typescript-eslint/no-explicit-any
+export type CompiledJuliaFunction = ((...args: any[]) => any) & {
+  /** Address of the `@cfunction` entry point. */
+  readonly ptr: Pointer;
+  /** Normalized signature, e.g. `(f64,ptr,i64)->f64`. */
+  readonly signature: string;
+};
 
 /**
  * Wrapper for Julia `Function`.
@@ -29,6 +80,20 @@ export class JuliaFunction extends Function implements JuliaValue {
     },
   );
 
+  /**
+   * Compiled entry points, keyed by function pointer and signature.
+   * The functions are bound to `const` globals, so their pointers stay valid.
+   */
+  private static compiled: Map<string, CompiledJuliaFunction> = new Map();
+  private static compiledCount = 0;
+
+  /**
+   * Trampoline types calling JS callbacks, keyed by signature. The types
+   * are bound to `const` globals, so their pointers stay valid.
+   */
+  private static trampolines: Map<string, Pointer> = new Map();
+  private static trampolineCount = 0;
+
   constructor(ptr: Pointer, name: string) {
     super();
     this.ptr = ptr;
@@ -38,9 +103,55 @@ export class JuliaFunction extends Function implements JuliaValue {
     });
   }
 
+  /**
+   * Get the trampoline type for `key`, defining it with the call method
+   * built by `method(typeName)` on first use.
+   */
+  private static trampoline(
+    key: string,
+    method: (typeName: string) => string,
+  ): Pointer {
+    let type = JuliaFunction.trampolines.get(key);
+    if (type === undefined) {
+      const name = `__jlbun_callback_${JuliaFunction.trampolineCount++}__`;
+      Julia.unsafe.eval(`
+struct ${name} <: Function
+  ptr::Ptr{Cvoid}
+end
+${method(name)}
+nothing`);
+      type = jlbun.symbols.jl_function_getter(
+        Julia.Main.ptr,
+        safeCString(name),
+      )!;
+      JuliaFunction.trampolines.set(key, type);
+    }
+    return type;
+  }
+
+  // Wrap a JSCallback in an instance of a trampoline type
+  private static fromCallback(
+    cb: JSCallback,
+    trampoline: Pointer,
+    name: string,
+  ): JuliaFunction {
+    const ptr = jlbun.symbols.jlbun_callback_new(trampoline, cb.ptr)!;
+    const func = Julia.adoptValue(new JuliaFunction(ptr, name || "anonymous"));
+    func.rawCB = cb;
+
+    // Register for automatic cleanup when func is garbage collected
+    JuliaFunction.callbackRegistry.register(func, cb, func);
+
+    return func;
+  }
+
   /**
    * Create a `JuliaFunction` from a JS function.
    *
+   * Julia calls the function through a trampoline compiled once per
+   * signature, so wrapping further functions of the same signature costs
+   * no `eval` or compilation.
+   *
    * The underlying `JSCallback` will be automatically cleaned up when the
    * returned `JuliaFunction` is garbage collected. You can also manually
    * call `.close()` to release resources earlier.
@@ -54,40 +165,175 @@ export class JuliaFunction extends Function implements JuliaValue {
     jsFunc: (...args: any[]) => any,
     definition: FFIFunction,
   ): JuliaFunction {
-    const cb = new JSCallback(jsFunc, definition);
     const returnType = mapFFITypeToJulia(definition.returns ?? "void");
     const argTypes = (definition.args ?? []).map((arg) =>
       mapFFITypeToJulia(arg),
     );
-
-    const funcStr = `
-function (${Array.from({ length: argTypes.length }, (_, i) => `x${i}`).join(
-      ", ",
-    )})
+    const trampoline = JuliaFunction.trampoline(
+      `(${argTypes.join(",")})->${returnType}`,
+      (name) => {
+        const params = argTypes.map((_, i) => `x${i}`);
+        const values = argTypes.map((type, i) =>
+          type === "Ptr{Nothing}" ? `pointer_from_objref(x${i})` : `x${i}`,
+        );
+        return `
+function (cb::${name})(${params.join(", ")})
   ret = ccall(
-    convert(Ptr{Nothing}, ${cb.ptr}),
+    cb.ptr,
     ${returnType},
-    (${argTypes.join(", ")},),
-    ${Array.from({ length: argTypes.length }, (_, i) => {
-      if (argTypes[i] === "Ptr{Nothing}") {
-        return `pointer_from_objref(x${i})`;
-      } else {
-        return `x${i}`;
-      }
-    }).join(", ")}
+    (${argTypes.map((type) => `${type},`).join(" ")}),
+    ${values.join(", ")}
   )
+  ${returnType === "Cstring" ? "unsafe_string(ret)" : "ret"}
+end`;
+      },
+    );
 
-  ${returnType === "Cstring" ? "ret = unsafe_string(ret)" : ""}
-end
-    `;
+    const cb = new JSCallback(jsFunc, definition);
+    return JuliaFunction.fromCallback(cb, trampoline, jsFunc.name);
+  }
 
-    const func = Julia.eval(funcStr) as JuliaFunction;
-    func.rawCB = cb;
+  /**
+   * Create a `JuliaFunction` that maps whole arrays with one call into JS.
+   *
+   * Called with an array of `definition.arg` elements, the function converts
+   * it to a dense `Array` if needed, allocates an output array of the same
+   * shape with `definition.returns` elements and hands both buffers to
+   * `jsFunc` as `TypedArray` views, crossing the boundary once per array
+   * instead of once per element. Both views are only valid during the call.
+   *
+   * @param jsFunc The JS function filling `output` from `input`.
+   * @param definition Element types of the input and output buffers.
+   *
+   * @example
+   * ```typescript
+   * Julia.scope((julia) => {
+   *   const double = JuliaFunction.fromVectorized(
+   *     (input: Float64Array, output: Float64Array) => {
+   *       for (let i = 0; i < input.length; i++) output[i] = 2 * input[i];
+   *     },
+   *     { arg: "f64", returns: "f64" },
+   *   );
+   *   double(julia.Array.from(new Float64Array([1, 2, 3]))); // [2.0, 4.0, 6.0]
+   * });
+   * ```
+   */
+  public static fromVectorized<I extends BunArray, O extends BunArray>(
+    jsFunc: (input: I, output: O) => void,
+    definition: VectorizedCallbackDefinition,
+  ): JuliaFunction {
+    const argType = mapFFITypeToJulia(definition.arg);
+    const returnType = mapFFITypeToJulia(definition.returns);
+    const Input = VECTORIZED_ARRAYS[argType];
+    const Output = VECTORIZED_ARRAYS[returnType];
+    if (Input === undefined || Output === undefined) {
+      throw new TypeError(
+        `Unsupported vectorized callback types: ${argType} -> ${returnType}`,
+      );
+    }
+    const trampoline = JuliaFunction.trampoline(
+      `[${argType}]->[${returnType}]`,
+      (name) => `
+function (cb::${name})(xs::AbstractArray)
+  src = xs isa Array{${argType}} ? xs : convert(Array{${argType}}, xs)
+  out = similar(src, ${returnType})
+  isempty(src) || GC.@preserve src out ccall(
+    cb.ptr, Cvoid, (Ptr{${argType}}, Ptr{${returnType}}, Csize_t),
+    src, out, length(src))
+  out
+end`,
+    );
 
-    // Register for automatic cleanup when func is garbage collected
-    JuliaFunction.callbackRegistry.register(func, cb, func);
+    const cb = new JSCallback(
+      (input: Pointer, output: Pointer, length: number) => {
+        const n = Number(length);
+        const inputBytes = n * Input.BYTES_PER_ELEMENT;
+        const outputBytes = n * Output.BYTES_PER_ELEMENT;
+        jsFunc(
+          new Input(toArrayBuffer(input, 0, inputBytes)) as I,
+          new Output(toArrayBuffer(output, 0, outputBytes)) as O,
+        );
+      },
+      {
+        args: [FFIType.ptr, FFIType.ptr, FFIType.u64_fast],
+        returns: FFIType.void,
+      },
+    );
+    return JuliaFunction.fromCallback(cb, trampoline, jsFunc.name);
+  }
 
-    return func;
+  /**
+   * Compile this function into a native entry point via `@cfunction` and
+   * expose it as a Bun `CFunction`.
+   *
+   * Calling the result jumps straight into the specialized Julia method,
+   * skipping argument boxing, dynamic dispatch and result wrapping. Results
+   * are cached per (function, signature), so repeated calls are cheap.
+   *
+   * **WARNING**: Julia exceptions cannot propagate through the native entry
+   * point and will abort the process. Only compile functions that cannot
+   * throw for the inputs they receive.
+   *
+   * @param signature Native signature using Bun FFI type names, e.g.
+   * `"(f64, ptr, i64) -> f64"`.
+   *
+   * @example
+   * ```typescript
+   * Julia.scope((julia) => {
+   *   const sin = julia.Base.sin.compile("(f64) -> f64");
+   *   sin(0.5); // 0.479425538604203
+   * });
+   * ```
+   */
+  compile(signature: string): CompiledJuliaFunction {
+    const { args, returns } = parseFFISignature(signature);
+    const normalized = `(${args.join(",")})->${returns}`;
+    const key = `${this.ptr}:${normalized}`;
+    const cached = JuliaFunction.compiled.get(key);
+    if (cached !== undefined) {
+      return cached;
+    }
+
+    const argTypes = args.map((arg) => `${mapFFITypeToJulia(arg)},`);
+    const types = `${mapFFITypeToJulia(returns)}, (${argTypes.join(" ")})`;
+
+    // `@cfunction` needs a constant callee, so bind the function to a global
+    const binding = `__jlbun_cfunction_${JuliaFunction.compiledCount++}__`;
+    Julia.setGlobal(binding, this);
+    try {
+      Julia.unsafe.eval(`const ${binding} = __jlbun_globals__["${binding}"]`);
+    } finally {
+      Julia.deleteGlobal(binding);
+    }
+
+    let fptr: Pointer;
+    try {
+      fptr = (Julia.eval(`@cfunction(${binding}, ${types})`) as JuliaPtr)
+        .value;
+    } catch {
+      // Callables that are not singletons need a runtime closure, which must
+      // stay rooted as long as the entry point can be called
+      Julia.unsafe.eval(
+        `const ${binding}closure = @cfunction($${binding}, ${types})`,
+      );
+      fptr = (
+        Julia.eval(
+          `Base.unsafe_convert(Ptr{Cvoid}, ${binding}closure)`,
+        ) as JuliaPtr
+      ).value;
+    }
+
+    const compiled = CFunction({
+      ptr: fptr,
+      args,
+      returns,
+    }) as unknown as CompiledJuliaFunction;
+    Object.defineProperties(compiled, {
+      ptr: { value: fptr },
+      signature: { value: normalized },
+    });
+    JuliaFunction.compiled.set(key, compiled);
+    return compiled;
   }
 
   /**
@@ -1,5 +1,122 @@
 import { Pointer } from "bun:ffi";
-import { jlbun, JuliaValue } from "./index.js";
+import { jlbun, JuliaValue, type ScopeMode } from "./index.js";
+
+/**
+ * Lock and occupancy counters of one root storage shard.
+ */
+export interface GCShardStats {
+  /** Number of times the shard lock was taken. */
+  acquisitions: number;
+  /** Number of acquisitions that found the lock held by another thread. */
+  contentions: number;
+  /** Occupied root slots in the shard. */
+  live: number;
+  /** Slot capacity of the shard. */
+  capacity: number;
+}
+
+/**
+ * Counters of both root stacks, read by `GCManager.stats()`.
+ *
+ * Activity counters are cumulative since the stack was initialized; compute
+ * rates from the difference of two reads. Perf stack fields are 0 until a
+ * perf scope has been used.
+ */
+export interface GCStats {
+  /** Values rooted in the scoped stack. */
+  pushes: number;
+  /** Slots freed by single releases and scope ends. */
+  releases: number;
+  /** Values moved to another scope, including escapes. */
+  transfers: number;
+  /** Values escaped to the global scope. */
+  escapes: number;
+  /** Scopes ended. */
+  scopeEnds: number;
+  /** Slots visited by scope ends; divide by `scopeEnds` for the mean. */
+  slotsScanned: number;
+  /** Most slots visited by a single scope end. */
+  maxScopeSlots: number;
+  /** Occupied slots. */
+  live: number;
+  /** Peak occupied slots (sum of the per-shard peaks). */
+  highWater: number;
+  /** Slots held by allocated segments. */
+  capacity: number;
+  /** Free slots inside partially used segments. */
+  fragmentation: number;
+  /** Segments added after initialization. */
+  segmentGrows: number;
+  /** Idle segments released. */
+  segmentTrims: number;
+  /** Shard lock acquisitions. */
+  lockAcquisitions: number;
+  /** Shard lock acquisitions that had to wait. */
+  lockContentions: number;
+  /** Total time spent waiting for shard locks, in nanoseconds. */
+  lockWaitNs: number;
+  /** Values pushed onto the perf stack. */
+  perfPushes: number;
+  /** Perf stack slots released. */
+  perfReleases: number;
+  /** Current perf stack size. */
+  perfSize: number;
+  /** Peak perf stack size. */
+  perfHighWater: number;
+  /** Perf stack capacity. */
+  perfCapacity: number;
+  /** Perf stack capacity growth events. */
+  perfResizes: number;
+}
+
+const GC_STATS_FIELDS: (keyof GCStats)[] = [
+  "pushes",
+  "releases",
+  "transfers",
+  "escapes",
+  "scopeEnds",
+  "slotsScanned",
+  "maxScopeSlots",
+  "live",
+  "highWater",
+  "capacity",
+  "fragmentation",
+  "segmentGrows",
+  "segmentTrims",
+  "lockAcquisitions",
+  "lockContentions",
+  "lockWaitNs",
+  "perfPushes",
+  "perfReleases",
+  "perfSize",
+  "perfHighWater",
+  "perfCapacity",
+  "perfResizes",
+];
+
+/**
+ * Rooting summary of one disposed `JuliaScope`, passed to
+ * `GCManager.onScopeSummary`.
+ */
+export interface ScopeSummary {
+  /** Scope ID (0n for perf scopes, which have none). */
+  scopeId: bigint;
+  mode: ScopeMode;
+  /**
+   * Values tracked by the scope when it was disposed. Perf scopes do not
+   * track values one by one: for them, this is the number of values on the
+   * perf stack above the scope's mark.
+   */
+  tracked: number;
+  /** Values escaped from the scope, including safe-mode transfers at dispose. */
+  escaped: number;
+  /** Root slots released at dispose. */
+  released: number;
+  /** Time from scope creation to dispose, in milliseconds. */
+  durationMs: number;
+  /** Time spent releasing roots at dispose, in milliseconds. */
+  releaseMs: number;
+}
 
 /**
  * Scope-based GC Manager for automatic lifecycle management of Julia objects.
@@ -8,11 +125,15 @@ import { jlbun, JuliaValue } from "./index.js";
  * JavaScript and Julia runtimes using scope-based isolation.
  *
  * Design:
- *   - Uses a Julia Vector{Any} as backing storage
+ *   - Backing storage is made of fixed-size segments, each a rooted Julia
+ *     Vector{Any} chunk; growth appends a segment without copying, and
+ *     segments left empty for `idleThresholdMs` are released
  *   - Scope-based: each value belongs to a scope_id, scopes can be released independently
- *   - Thread-safe: protected by mutex in C layer
+ *   - Thread-safe: root storage is split into lock-sharded partitions in the
+ *     C layer; a scope maps to one shard, so concurrent scopes rarely contend
  *   - Concurrent-safe: scopes can be released in any order (safe for async)
- *   - Efficient: O(1) push, O(n) release (only touches scope's values)
+ *   - Efficient: O(1) push, O(k) scope release touching only the scope's own
+ *     k slots (per-scope slot chains); released slots are reused via a free list
  *   - FinalizationRegistry fallback: escaped objects are auto-cleaned when JS GC runs
  *
  * API:
@@ -20,13 +141,15 @@ import { jlbun, JuliaValue } from "./index.js";
  *   - pushScoped(value, scopeId): Push value to specific scope
  *   - scopeEnd(scopeId): Release all values in scope
  *   - transfer(idx, newScopeId): Move value to another scope (for escape)
+ *   - pushScopedMany(ptrs, scopeId) / releaseMany(idxs): Bulk variants
+ *   - stats(): Activity counters of both root stacks
  */
 export class GCManager {
   private static readonly DEFAULT_CAPACITY = 1024;
 
   /**
    * FinalizationRegistry for escaped objects.
-   * When a JS object is garbage collected, its Julia root slot is cleared.
+   * When a JS object is garbage collected, its Julia root slot is released.
    */
   private static escapeRegistry: FinalizationRegistry<number> | null = null;
 
@@ -36,6 +159,14 @@ export class GCManager {
    */
   private static closed = true;
 
+  /**
+   * Opt-in listener called with a `ScopeSummary` each time a `JuliaScope` is
+   * disposed, e.g. to feed rooting cost into metrics. Only scopes created
+   * while a listener is set are reported. Errors thrown by the listener are
+   * ignored.
+   */
+  static onScopeSummary: ((summary: ScopeSummary) => void) | null = null;
+
   /**
    * Initialize the GC manager.
    * Called by Julia.init() after Julia is fully initialized.
@@ -51,11 +182,8 @@ export class GCManager {
       if (this.closed) return;
 
       try {
-        // Clear the slot when JS object is garbage collected
-        jlbun.symbols.jlbun_gc_set(
-          BigInt(idx),
-          jlbun.symbols.jl_nothing_getter(),
-        );
+        // Release the slot (back to the free list) when JS object is collected
+        jlbun.symbols.jlbun_gc_release(BigInt(idx));
       } catch {
         // Julia might be closed, ignore errors
       }
@@ -118,18 +246,23 @@ export class GCManager {
    * This is safe to call even if other scopes are still active.
    *
    * @param scopeId The scope to release
+   * @returns The number of released slots
    */
-  static scopeEnd(scopeId: bigint): void {
-    jlbun.symbols.jlbun_gc_scope_end(scopeId);
+  static scopeEnd(scopeId: bigint): number {
+    return Number(jlbun.symbols.jlbun_gc_scope_end(scopeId));
   }
 
   /**
    * Transfer a value to a different scope (for escape).
    * The value will now be released when the new scope ends.
    *
+   * Transfers to the global scope (0n) keep the index. A transfer to a scope
+   * living in another shard moves the value, so always use the returned index
+   * afterwards.
+   *
    * @param idx The index of the value to transfer
    * @param newScopeId The new scope to transfer to (use 0n for global/permanent)
-   * @returns The same index, or -1 on error
+   * @returns The index of the value after the transfer, or -1 on error
    */
   static transfer(idx: number, newScopeId: bigint): number {
     const result = jlbun.symbols.jlbun_gc_transfer(BigInt(idx), newScopeId);
@@ -172,7 +305,8 @@ export class GCManager {
   }
 
   /**
-   * Release a single temporary root slot.
+   * Release a single root slot and return it to the free list.
+   * Releasing a slot that is already free is a no-op.
    *
    * @internal
    */
@@ -181,22 +315,148 @@ export class GCManager {
   }
 
   /**
-   * Get the number of protected objects.
+   * Push many raw Julia pointers into one scope with a single lock
+   * acquisition.
+   *
+   * @param ptrs The Julia pointers to protect
+   * @param scopeId The scope these values belong to
+   * @returns The index of each value, or null on error (nothing is pushed)
+   */
+  static pushScopedMany(
+    ptrs: BigUint64Array,
+    scopeId: bigint,
+  ): number[] | null {
+    const out = new BigUint64Array(ptrs.length);
+    const pushed = jlbun.symbols.jlbun_gc_push_scoped_many(
+      ptrs,
+      BigInt(ptrs.length),
+      scopeId,
+      out,
+    );
+    if (Number(pushed) !== ptrs.length) {
+      return null;
+    }
+    return Array.from(out, Number);
+  }
+
+  /**
+   * Release many root slots at once. Slots of the same shard that are next
+   * to each other in `idxs` share one lock acquisition.
+   * Releasing a slot that is already free is a no-op.
+   *
+   * @internal
+   */
+  static releaseMany(idxs: number[]): void {
+    if (idxs.length === 0) {
+      return;
+    }
+    const raw = BigUint64Array.from(idxs, BigInt);
+    jlbun.symbols.jlbun_gc_release_many(raw, BigInt(raw.length));
+  }
+
+  /**
+   * Get the number of protected objects (occupied root slots).
    */
   static get size(): number {
     return Number(jlbun.symbols.jlbun_gc_size());
   }
 
   /**
-   * Get the current capacity of the root stack.
+   * Get the current capacity of the root stack: the number of slots held by
+   * allocated segments across all shards. Grows by whole segments and shrinks
+   * again when idle segments are released.
    */
   static get capacity(): number {
     return Number(jlbun.symbols.jlbun_gc_capacity());
   }
 
+  /**
+   * Number of root slots in one storage segment.
+   */
+  static get segmentSize(): number {
+    return Number(jlbun.symbols.jlbun_gc_segment_size());
+  }
+
+  /**
+   * How long (in milliseconds) a segment must stay empty before it is
+   * released. One empty segment per shard is always kept as a spare.
+   * Defaults to 1000.
+   *
+   * Idle segments are released when values are released or scopes begin, so
+   * a process that stops calling into Julia keeps them until `trim()`.
+   */
+  static get idleThresholdMs(): number {
+    return Number(jlbun.symbols.jlbun_gc_get_idle_threshold());
+  }
+
+  static set idleThresholdMs(ms: number) {
+    if (!Number.isFinite(ms) || ms < 0) {
+      throw new RangeError("idleThresholdMs must be a non-negative number");
+    }
+    jlbun.symbols.jlbun_gc_set_idle_threshold(BigInt(Math.floor(ms)));
+  }
+
+  /**
+   * Release all empty segments beyond the per-shard spare right away,
+   * regardless of `idleThresholdMs`.
+   *
+   * @returns The number of released segments
+   */
+  static trim(): number {
+    return Number(jlbun.symbols.jlbun_gc_trim());
+  }
+
+  /**
+   * Number of lock-sharded partitions of the root storage.
+   */
+  static get shardCount(): number {
+    return Number(jlbun.symbols.jlbun_gc_shard_count());
+  }
+
+  /**
+   * Get the shard holding the values of a scope.
+   * A slot index belongs to shard `idx % GCManager.shardCount`.
+   *
+   * @param scopeId The scope to look up
+   * @returns The shard index
+   */
+  static shardOf(scopeId: bigint): number {
+    return Number(jlbun.symbols.jlbun_gc_scope_shard(scopeId));
+  }
+
+  /**
+   * Read the per-shard lock and occupancy counters.
+   * A high `contentions / acquisitions` ratio on a shard means threads are
+   * queuing on its lock.
+   *
+   * @returns One entry per shard
+   */
+  static shardStats(): GCShardStats[] {
+    const count = this.shardCount;
+    const raw = new BigUint64Array(count * 4);
+    jlbun.symbols.jlbun_gc_shard_stats(raw);
+    return Array.from({ length: count }, (_, i) => ({
+      acquisitions: Number(raw[i * 4]),
+      contentions: Number(raw[i * 4 + 1]),
+      live: Number(raw[i * 4 + 2]),
+      capacity: Number(raw[i * 4 + 3]),
+    }));
+  }
+
+  /**
+   * Read the counters of both root stacks in a single call.
+   */
+  static stats(): GCStats {
+    const raw = new BigUint64Array(GC_STATS_FIELDS.length);
+    jlbun.symbols.jlbun_gc_stats(raw);
+    const stats = {} as GCStats;
+    GC_STATS_FIELDS.forEach((field, i) => (stats[field] = Number(raw[i])));
+    return stats;
+  }
+
   /**
    * Register an escaped value with FinalizationRegistry.
-   * When the JS object is garbage collected, the Julia root slot will be cleared.
+   * When the JS object is garbage collected, the Julia root slot will be released.
    *
    * @param value The Julia value to register
    * @param idx The index in the GC stack where the value is stored
@@ -272,6 +532,24 @@ export class GCManager {
     return Number(result);
   }
 
+  /**
+   * Push many raw Julia pointers onto the perf stack. They occupy
+   * consecutive slots, so the index of `ptrs[i]` is the returned index + i.
+   *
+   * @param ptrs The Julia pointers to protect
+   * @returns The index of the first value, or -1 on error
+   */
+  static perfPushMany(ptrs: BigUint64Array): number {
+    const result = jlbun.symbols.jlbun_gc_perf_push_many(
+      ptrs,
+      BigInt(ptrs.length),
+    );
+    if (result === 0xffffffffffffffffn) {
+      return -1;
+    }
+    return Number(result);
+  }
+
   /**
    * Release all values from mark position to current top.
    * This is O(1) amortized - just resets the stack pointer
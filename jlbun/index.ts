@@ -19,15 +19,61 @@ export interface JuliaOptions {
   project: string | null;
   verbosity?: "quiet" | "normal" | "verbose";
   prefetchFilter?: boolean;
+  /**
+   * Write a `precompile` statement for every method compiled during the
+   * session to this file, like `julia --trace-compile`, as input for
+   * `julia/build.jl`. Defaults to `$JLBUN_TRACE_COMPILE`.
+   */
+  traceCompile?: string;
+  /**
+   * `"lazy"` (the default) looks module bindings up on first use. `"eager"`
+   * looks up every export of `Core` and `Base` during `Julia.init`.
+   */
+  prefetch?: "lazy" | "eager";
+  /**
+   * Record the module bindings looked up during the session to this JSON
+   * file, and warm the ones recorded by previous runs in the background
+   * after `Julia.init`. Defaults to `$JLBUN_HOT_BINDINGS`.
+   */
+  hotBindings?: string;
+}
+
+/**
+ * Time spent in each phase of `Julia.init`, in milliseconds.
+ */
+export interface JuliaInitProfile {
+  /** `jl_init` or `jl_init_with_image`. */
+  jlInit: number;
+  /** Builtin type getters and the type caches of `wrapPtr`. */
+  typeGetters: number;
+  /** `Core`, `Base`, `Main` and the `Pkg` import. */
+  modules: number;
+  /** Activating and instantiating the project. */
+  project: number;
+  /** `nthreads`, `VERSION`, the sysimage check and jlbun's globals. */
+  evals: number;
+  /** The GC manager's root stack. */
+  gcInit: number;
+  /** Eager prefetch, or loading the hot bindings. */
+  prefetch: number;
+  /** The whole of `Julia.init`. */
+  total: number;
 }
 
 export {
+  type BulkAccessOptions,
   type BunArray,
   type FromBunArrayOptions,
   JuliaArray,
+  type PackedStrings,
+  packStrings,
+  type PackStringsOptions,
+  unpackStrings,
 } from "./arrays.js";
+export { JuliaBatch, JuliaBatchSlot } from "./batch.js";
+export { type JuliaColumn } from "./columns.js";
 export { ComplexElementType, JuliaComplex } from "./complex.js";
-export { JuliaDict, JuliaIdDict } from "./dicts.js";
+export { JuliaDict, type JuliaDictColumns, JuliaIdDict } from "./dicts.js";
 export {
   ArgumentError,
   BoundsError,
@@ -52,12 +98,22 @@ export {
   UndefVarError,
   UnknownJuliaError,
 } from "./errors.js";
-export { JuliaFunction } from "./functions.js";
-export { Julia, MIME } from "./julia.js";
+export {
+  type CompiledJuliaFunction,
+  JuliaFunction,
+  type VectorizedCallbackDefinition,
+} from "./functions.js";
+export { type EvalOptions, Julia, MIME } from "./julia.js";
 export { JuliaModule } from "./modules.js";
+export {
+  type ParallelMapOptions,
+  type ParallelReduceOptions,
+} from "./parallel.js";
 export { JuliaRange } from "./ranges.js";
+export { type RpcOptions } from "./rpc.js";
 export { JuliaSet } from "./sets.js";
 export { JuliaSubArray } from "./subarrays.js";
+export { type SysimageManifest } from "./sysimage.js";
 export { JuliaTask } from "./tasks.js";
 export { JuliaNamedTuple, JuliaPair, JuliaTuple } from "./tuples.js";
 export { JuliaDataType } from "./types.js";
@@ -85,7 +141,12 @@ export {
 export { jlbun } from "./wrapper.js";
 
 // Re-export types for external use (ScopedJulia is the interface for scope callbacks)
-export { GCManager } from "./gc.js";
+export {
+  GCManager,
+  type GCShardStats,
+  type GCStats,
+  type ScopeSummary,
+} from "./gc.js";
 export {
   enterJuliaScope,
   JuliaScope,
@@ -1,4 +1,4 @@
-import { Pointer } from "bun:ffi";
+import { Pointer, toArrayBuffer } from "bun:ffi";
 import { randomUUID } from "crypto";
 import {
   createJuliaError,
@@ -6,6 +6,7 @@ import {
   jlbun,
   JuliaAny,
   JuliaArray,
+  JuliaBatch,
   JuliaBool,
   JuliaChar,
   JuliaComplex,
@@ -16,6 +17,7 @@ import {
   JuliaFloat64,
   JuliaFunction,
   JuliaIdDict,
+  JuliaInitProfile,
   JuliaInt8,
   JuliaInt16,
   JuliaInt32,
@@ -54,7 +56,26 @@ import {
   markJuliaRuntimeValue,
   setJuliaOwnership,
 } from "./ownership.js";
+import {
+  parallelMap,
+  ParallelMapOptions,
+  parallelReduce,
+  ParallelReduceOptions,
+} from "./parallel.js";
+import { closeHotBindings, loadHotBindings } from "./prefetch.js";
+import {
+  closeRpc,
+  rpcCall,
+  RpcOptions,
+  rpcRunning,
+  rpcStart,
+  rpcStop,
+} from "./rpc.js";
 import { getActiveJuliaScope, runWithJuliaScope } from "./scope.js";
+import { checkSysimageManifest, sysimageManifestPath } from "./sysimage.js";
+import { closeTaskPoller } from "./tasks.js";
+import { namedTupleType } from "./tuples.js";
+import { juliaHelper } from "./utils.js";
 
 export enum MIME {
   Default = "",
@@ -64,19 +85,137 @@ export enum MIME {
   TextMarkdown = "text/markdown",
 }
 
+/**
+ * Options of `Julia.eval()`.
+ */
+export interface EvalOptions {
+  /**
+   * Compile the code into a thunk once and call the thunk on later
+   * evaluations of the same code, skipping parsing, lowering and inference.
+   * Code that only works at top level (definitions, imports, macros,
+   * assignments to globals) is still evaluated as is.
+   *
+   * Compiled code stays in the Julia session for the life of the process,
+   * so only use this for a bounded set of sources, not for code built from
+   * changing values (use `Julia.tagEval` for those).
+   */
+  cache?: boolean;
+}
+
+// Compiles code into a function of its `__jlbun_arg_<i>__` placeholders, or
+// returns `nothing` if the code has to run at top level: it defines types,
+// modules, constants, methods or globals, imports, or uses macros or quotes
+const TEMPLATE_HELPER = `let
+    unportable = (:struct, :abstract, :primitive, :module, :using, :import,
+                  :export, :const, :global, :macro, :macrocall, :quote,
+                  Symbol("\\$"), :toplevel, :error, :incomplete)
+    scoped = (:let, :function, Symbol("->"), :do, :for, :while, :try,
+              :comprehension, :generator, :tuple, :parameters)
+    binds(lhs) = !(Meta.isexpr(lhs, :ref) || Meta.isexpr(lhs, Symbol(".")))
+    function portable(ex, top)
+        ex isa Expr || return true
+        ex.head in unportable && return false
+        if top
+            head = string(ex.head)
+            endswith(head, "=") && !startswith(head, ".") &&
+                binds(ex.args[1]) && return false
+            ex.head === :function && !Meta.isexpr(ex.args[1], :tuple) &&
+                return false
+        end
+        inner = top && !(ex.head in scoped)
+        return all(arg -> portable(arg, inner), ex.args)
+    end
+    function (code::String, nargs::Real)
+        ex = try
+            Meta.parseall(code)
+        catch
+            return nothing
+        end
+        all(arg -> portable(arg, true), ex.args) || return nothing
+        params = [Symbol("__jlbun_arg_", i, "__") for i in 1:Int(nargs)]
+        try
+            Core.eval(Main, Expr(Symbol("->"), Expr(:tuple, params...),
+                                 Expr(:block, ex.args...)))
+        catch
+            nothing
+        end
+    end
+end`;
+
+// Wrapper kinds returned by `jlbun_classify_type`, matching JLBUN_KIND_* in
+// c/wrapper.c
+enum WrapperKind {
+  Any,
+  Function,
+  Symbol,
+  Module,
+  Type,
+  Array,
+  Tuple,
+  Pair,
+  NamedTuple,
+  Ptr,
+  Set,
+  Dict,
+  IdDict,
+  Range,
+  SubArray,
+  Complex,
+}
+
+type WrapperConstructor = (ptr: Pointer) => JuliaValue;
+
+/**
+ * Builds the constructor for all values of one type, given the first value
+ * and the element type reported by `jlbun_classify_type` (if any).
+ */
+type WrapperFactory = (
+  ptr: Pointer,
+  param: Pointer | null,
+) => WrapperConstructor;
+
 const DEFAULT_JULIA_OPTIONS = {
   bindir: "",
   sysimage: "",
   project: "",
   verbosity: "normal" as const,
+  traceCompile: process.env.JLBUN_TRACE_COMPILE ?? "",
+  prefetch: "lazy" as const,
+  hotBindings: process.env.JLBUN_HOT_BINDINGS ?? "",
 };
 
+// Value kinds understood by jlbun_box_many
+const BOX_INT64 = 0;
+const BOX_FLOAT64 = 1;
+const BOX_BOOL = 2;
+// Below this many primitives, wrapping them one by one is just as fast
+const BULK_WRAP_THRESHOLD = 4;
+
 export class Julia {
   private static options: JuliaOptions = DEFAULT_JULIA_OPTIONS;
   private static globals: JuliaIdDict;
   private static _defaultScopeMode: ScopeMode = "default";
+  // Templates of `tagEval` compiled into functions of their values; null for
+  // templates that have to run at top level
+  private static compiledTemplates: WeakMap<
+    TemplateStringsArray,
+    JuliaFunction | null
+  > = new WeakMap();
+  // Thunks of `Julia.eval(code, { cache: true })`, least recently used first
+  private static evalCache: Map<string, JuliaFunction | null> = new Map();
   public static nthreads: number;
   public static version: string;
+  /**
+   * Time spent in each phase of the last `Julia.init`, in milliseconds.
+   */
+  public static initProfile: JuliaInitProfile;
+  /**
+   * Maximum number of sources whose thunks `Julia.eval(code, { cache: true })`
+   * looks up, least recently used first out. This bounds the lookup table
+   * only: an evicted thunk is not freed in Julia, and evaluating its source
+   * again compiles a new one.
+   */
+  public static evalCacheCapacity = 256;
 
   public static Core: JuliaModule;
   public static Base: JuliaModule;
@@ -134,11 +273,64 @@ export class Julia {
   private static runtimeRootPtrs: Set<Pointer> = new Set();
 
   // Type constructors map: type pointer -> constructor function
-  // Initialized in init() after all types are available
-  private static simpleTypeConstructors: Map<
-    Pointer,
-    (ptr: Pointer) => JuliaValue
-  > = new Map();
+  // Seeded in init() with the primitive types; every other concrete type
+  // (including parametric families such as `Vector{Float64}` or
+  // `Dict{String, Int64}`) is added when its first value is wrapped
+  private static simpleTypeConstructors: Map<Pointer, WrapperConstructor> =
+    new Map();
+
+  // Out-parameter of `jlbun_classify_type`
+  private static classifyParam = new BigUint64Array(1);
+
+  // Constructor factories indexed by `WrapperKind`
+  private static wrapperFactories: Record<WrapperKind, WrapperFactory> = {
+    [WrapperKind.Any]: () => (ptr) => new JuliaAny(ptr),
+    [WrapperKind.Function]: (first) => {
+      const typeStr = jlbun.symbols.jl_typeof_str(first).toString();
+      const name = Julia.functionNameFromType(typeStr);
+      return (ptr) => new JuliaFunction(ptr, name);
+    },
+    [WrapperKind.Symbol]: () => (ptr) => {
+      const namePtr = jlbun.symbols.jl_symbol_name_getter(ptr);
+      if (namePtr === null) {
+        throw new Error(
+          "Failed to get symbol name pointer from Julia symbol object",
+        );
+      }
+      return new JuliaSymbol(ptr, namePtr.toString());
+    },
+    [WrapperKind.Module]: () => (ptr) =>
+      new JuliaModule(ptr, Julia.unsafeString(ptr)),
+    [WrapperKind.Type]: () => (ptr) =>
+      new JuliaDataType(ptr, Julia.unsafeString(ptr)),
+    [WrapperKind.Array]: (_, elType) => {
+      const elTypeStr = Julia.getTypeStr(elType!);
+      return (ptr) =>
+        new JuliaArray(ptr, new JuliaDataType(elType!, elTypeStr));
+    },
+    [WrapperKind.Tuple]: () => (ptr) => new JuliaTuple(ptr),
+    [WrapperKind.Pair]: () => (ptr) => new JuliaPair(ptr),
+    [WrapperKind.NamedTuple]: () => (ptr) => new JuliaNamedTuple(ptr),
+    [WrapperKind.Ptr]: () => (ptr) => new JuliaPtr(ptr),
+    [WrapperKind.Set]: () => (ptr) => new JuliaSet(ptr),
+    [WrapperKind.Dict]: () => (ptr) => new JuliaDict(ptr),
+    [WrapperKind.IdDict]: () => (ptr) => new JuliaIdDict(ptr),
+    [WrapperKind.Range]: () => (ptr) => new JuliaRange(ptr),
+    [WrapperKind.SubArray]: (_, elType) => {
+      const elTypeStr = Julia.getTypeStr(elType!);
+      return (ptr) =>
+        new JuliaSubArray(ptr, new JuliaDataType(elType!, elTypeStr));
+    },
+    [WrapperKind.Complex]: (_, elType) => {
+      const typeStr =
+        elType === Julia.Float64.ptr
+          ? "ComplexF64"
+          : elType === Julia.Float32.ptr
+            ? "ComplexF32"
+            : "ComplexF16";
+      return (ptr) => JuliaComplex.wrap(ptr, typeStr);
+    },
+  };
 
   public static unsafe = {
     eval: (code: string): JuliaValue => Julia.unsafeEval(code),
@@ -155,7 +347,99 @@ export class Julia {
     wrapPtr: (ptr: Pointer): JuliaValue => Julia.unsafeWrapPtr(ptr),
   };
 
-  private static requireActiveScope(api: string): JuliaScope {
+  /**
+   * Chunked data parallelism over Julia threads. Each call partitions the
+   * array into `chunks` (default `Julia.nthreads`) contiguous chunks in one
+   * FFI crossing, processes them in `Threads.@spawn` tasks and returns one
+   * `Promise`, resolved without blocking the event loop like
+   * `JuliaTask.value`.
+   *
+   * @example
+   * ```typescript
+   * await Julia.scopeAsync(async (julia) => {
+   *   const xs = julia.Array.from(new Float64Array(1_000_000).fill(1));
+   *   const ys = await Julia.parallel.map(julia.Base.sin, xs);
+   *   const sumsq = await Julia.parallel.reduce(
+   *     julia.Base["+"],
+   *     julia.Base.abs2,
+   *     xs,
+   *   );
+   * });
+   * ```
+   */
+  public static parallel = {
+    /**
+     * Apply `f` to every element of `array`, writing into `out` (or a new
+     * array). Resolves to the output array.
+     */
+    map: (
+      f: JuliaFunction,
+      array: JuliaArray,
+      options?: ParallelMapOptions,
+    ): Promise<JuliaArray> => parallelMap(f, array, options),
+    /**
+     * Compute `mapreduce(f, op, array)` with one partial reduction per
+     * chunk. `op` must be associative; the promise rejects for an empty
+     * array.
+     */
+    reduce: (
+      op: JuliaFunction,
+      f: JuliaFunction,
+      array: JuliaArray,
+      options?: ParallelReduceOptions,
+    ): Promise<JuliaValue> => parallelReduce(op, f, array, options),
+  };
+
+  /**
+   * Pipelined asynchronous calls on a pool of long-running Julia worker
+   * tasks. `call()` enqueues the function and its arguments on a lock-free
+   * submission ring and returns immediately; idle workers dequeue and run
+   * the calls concurrently, and post results to a completion ring that
+   * resolves the promises in batches. Workers run on threads other than the
+   * main one when Julia has them (`--threads`), and cooperatively on the
+   * main thread otherwise.
+   *
+   * @example
+   * ```typescript
+   * Julia.rpc.start({ workers: 4 });
+   * await Julia.scopeAsync(async (julia) => {
+   *   const results = await Promise.all(
+   *     [1, 2, 3].map((x) => Julia.rpc.call(julia.Base.sqrt, x)),
+   *   );
+   * });
+   * await Julia.rpc.stop();
+   * ```
+   */
+  public static rpc = {
+    /**
+     * Start the worker pool. Throws while a previous `stop()` is still
+     * waiting for its workers to exit.
+     */
+    start: (options?: RpcOptions): void => rpcStart(options),
+    /**
+     * Run `f(args...)` on a worker. Resolves to the result, rooted in the
+     * scope active at the time of the call, or rejects with the Julia
+     * exception.
+     */
+    call: (f: JuliaFunction, ...args: unknown[]): Promise<JuliaValue> =>
+      rpcCall(f, ...args),
+    /**
+     * Wait for every pending call, then stop the workers. New calls are
+     * rejected from the moment this is called.
+     */
+    stop: (): Promise<void> => rpcStop(),
+    /**
+     * Whether the worker pool is running.
+     */
+    running: (): boolean => rpcRunning(),
+  };
+
+  /**
+   * Get the active scope, or throw a `ScopeRequiredError` naming `api`.
+   *
+   * @internal
+   */
+  public static requireActiveScope(api: string): JuliaScope {
     const scope = getActiveJuliaScope();
     if (scope === undefined || scope.isDisposed) {
       throw new ScopeRequiredError(
@@ -165,6 +449,26 @@ export class Julia {
     return scope;
   }
 
+  private static isPlainObject(
+    value: unknown,
+  ): value is Record<string, unknown> {
+    if (typeof value !== "object" || value === null) {
+      return false;
+    }
+    const proto = Object.getPrototypeOf(value);
+    return proto === Object.prototype || proto === null;
+  }
+
+  // Pointers of `values` as an argument array for the C helpers, with at
+  // least one (unused) element so there is always a buffer to pass
+  private static pointerArray(values: JuliaValue[]): BigInt64Array {
+    const ptrs = new BigInt64Array(Math.max(values.length, 1));
+    for (let i = 0; i < values.length; i++) {
+      ptrs[i] = BigInt(values[i].ptr);
+    }
+    return ptrs;
+  }
+
   private static markRuntimeValues(...values: JuliaValue[]): void {
     for (const value of values) {
       Julia.runtimeRootPtrs.add(value.ptr);
@@ -264,6 +568,20 @@ export class Julia {
     Julia.options = { ...Julia.options, ...extraOptions };
 
     if (!Julia.Base) {
+      const start = performance.now();
+      let lap = start;
+      const phase = (): number => {
+        const now = performance.now();
+        const elapsed = now - lap;
+        lap = now;
+        return elapsed;
+      };
+
+      if (Julia.options.traceCompile) {
+        jlbun.symbols.jlbun_set_trace_compile(
+          safeCString(Julia.options.traceCompile),
+        );
+      }
       if (Julia.options.sysimage === "" || Julia.options.bindir === "") {
         jlbun.symbols.jl_init0();
       } else {
@@ -272,6 +590,7 @@ export class Julia {
           safeCString(Julia.options.sysimage),
         );
       }
+      const jlInit = phase();
 
       Julia.Any = new JuliaDataType(jlbun.symbols.jl_any_type_getter()!, "Any");
       Julia.Nothing = new JuliaDataType(
@@ -465,6 +784,7 @@ export class Julia {
         Julia.Task.ptr,
         (ptr) => new JuliaTask(ptr),
       );
+      const typeGetters = phase();
 
       Julia.Core = new JuliaModule(
         jlbun.symbols.jl_core_module_getter()!,
@@ -480,6 +800,7 @@ export class Julia {
       );
       Julia.Pkg = Julia.unsafe.import("Pkg");
       Julia.markRuntimeValues(Julia.Core, Julia.Base, Julia.Main, Julia.Pkg);
+      const modules = phase();
 
       if (Julia.options.project === null) {
         Julia.unsafe.eval("Pkg.activate(; temp=true)");
@@ -489,11 +810,13 @@ export class Julia {
         );
         Julia.unsafe.eval("Pkg.instantiate()");
       }
+      const project = phase();
 
       Julia.nthreads = Number(Julia.unsafe.eval("Threads.nthreads()").value);
       Julia.version = (
         Julia.unsafe.eval("string(VERSION)") as JuliaString
       ).value;
+      Julia.checkSysimage();
       Julia.unsafe.eval("__jlbun_globals__ = IdDict()");
       Julia.globals = new JuliaIdDict(
         jlbun.symbols.jl_get_global(
@@ -502,9 +825,61 @@ export class Julia {
         )!,
       );
       Julia.markRuntimeValues(Julia.globals);
+      const evals = phase();
 
       // Initialize thread-safe GC manager
       GCManager.init();
+      const gcInit = phase();
+
+      // Bindings are looked up lazily by default; eager prefetch pays for
+      // every export up front
+      if (Julia.options.prefetch === "eager") {
+        Julia.prefetch(Julia.Core);
+        Julia.prefetch(Julia.Base);
+      }
+      if (Julia.options.hotBindings) {
+        loadHotBindings(Julia.options.hotBindings);
+      }
+      const prefetch = phase();
+
+      Julia.initProfile = {
+        jlInit,
+        typeGetters,
+        modules,
+        project,
+        evals,
+        gcInit,
+        prefetch,
+        total: lap - start,
+      };
+      if (Julia.options.verbosity === "verbose") {
+        const phases = Object.entries(Julia.initProfile)
+          .map(([name, ms]) => `${name} ${ms.toFixed(1)} ms`)
+          .join(", ");
+        console.log(`Julia.init: ${phases}`);
+      }
+    }
+  }
+
+  // Warn if the sysimage was built by `julia/build.jl` for another Julia
+  // version or from traces that changed since
+  private static checkSysimage(): void {
+    const { bindir, sysimage, verbosity } = Julia.options;
+    if (sysimage === "" || bindir === "" || verbosity === "quiet") {
+      return;
+    }
+    const manifest = sysimageManifestPath(bindir, sysimage);
+    let reason: string | null;
+    try {
+      reason = checkSysimageManifest(manifest, Julia.version);
+    } catch (err) {
+      reason = `unreadable manifest ${manifest} (${err})`;
+    }
+    if (reason !== null) {
+      console.warn(
+        `Sysimage ${sysimage} is stale: ${reason}. ` +
+          "Rebuild it with `just sysimage`.",
+      );
     }
   }
 
@@ -593,6 +968,93 @@ export class Julia {
     return Julia.adoptAutoWrappedValue(wrapped);
   }
 
+  /**
+   * Wrap several JS values, like `args.map(Julia.autoWrap)`. Numbers,
+   * bigints and booleans are boxed together in one FFI call and rooted with
+   * one bulk push.
+   *
+   * @internal
+   */
+  public static autoWrapMany(values: unknown[]): JuliaValue[] {
+    if (values.length < BULK_WRAP_THRESHOLD) {
+      return values.map((value) => Julia.autoWrap(value));
+    }
+
+    const primitive: number[] = [];
+    values.forEach((value, i) => {
+      if (Julia.isBoxablePrimitive(value)) {
+        primitive.push(i);
+      }
+    });
+    if (primitive.length < BULK_WRAP_THRESHOLD) {
+      return values.map((value) => Julia.autoWrap(value));
+    }
+
+    const vec = Julia.unsafeBoxMany(primitive.map((i) => values[i]));
+    const boxed = Julia.wrapVector(vec, primitive.length);
+    const wrapped = new Array<JuliaValue>(values.length);
+    primitive.forEach((i, j) => (wrapped[i] = boxed[j]));
+    for (let i = 0; i < values.length; i++) {
+      wrapped[i] ??= Julia.autoWrap(values[i]);
+    }
+    return wrapped;
+  }
+
+  /**
+   * Whether `Julia.unsafeBoxMany` can box a JS value: a number (except unsafe
+   * integers, which `Julia.autoWrap` handles on its own), a bigint that fits
+   * in an Int64, or a boolean.
+   *
+   * @internal
+   */
+  public static isBoxablePrimitive(value: unknown): boolean {
+    switch (typeof value) {
+      case "number":
+        return Number.isSafeInteger(value) || !Number.isInteger(value);
+      case "bigint":
+        return BigInt.asIntN(64, value) === value;
+      case "boolean":
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  /**
+   * Box JS primitives (see `isBoxablePrimitive`) into a new, unrooted
+   * `Vector{Any}` in a single FFI call. Each element gets the same type as
+   * `Julia.autoWrap` would give it.
+   *
+   * @internal
+   */
+  public static unsafeBoxMany(values: unknown[]): Pointer {
+    const n = values.length;
+    const kinds = new Uint8Array(n);
+    const payload = new BigInt64Array(n);
+    const bits = new Float64Array(payload.buffer);
+    for (let i = 0; i < n; i++) {
+      const value = values[i];
+      if (typeof value === "boolean") {
+        kinds[i] = BOX_BOOL;
+        payload[i] = value ? 1n : 0n;
+      } else if (typeof value === "bigint") {
+        kinds[i] = BOX_INT64;
+        payload[i] = value;
+      } else if (Number.isSafeInteger(value)) {
+        kinds[i] = BOX_INT64;
+        payload[i] = BigInt(value as number);
+      } else {
+        kinds[i] = BOX_FLOAT64;
+        bits[i] = value as number;
+      }
+    }
+    const vec = jlbun.symbols.jlbun_box_many(kinds, payload, n);
+    if (vec === null) {
+      throw new Error("Failed to box values");
+    }
+    return vec;
+  }
+
   // eslint-disable-next-line @typescript-eslint/no-explicit-any
   private static unsafeAutoWrap(value: any): JuliaValue {
     if (
@@ -690,8 +1152,8 @@ export class Julia {
 
   /**
    * Wrap a pointer as a `JuliaValue` object.
-   * Uses Map lookup for common types (O(1)) before falling back
-   * to string comparison for parametric and special types.
+   * Uses an O(1) Map lookup by type pointer; the first value of each type is
+   * classified by type name in C and its constructor cached.
    *
    * @param ptr Pointer to the Julia object.
    */
@@ -714,141 +1176,90 @@ export class Julia {
     return scope.adopt(value, idx);
   }
 
-  private static unsafeWrapPtr(ptr: Pointer): JuliaValue {
-    const finish = <T extends JuliaValue>(value: T): T =>
-      Julia.markRuntimePointerValue(value);
-    const typePtr = jlbun.symbols.jl_typeof_getter(ptr)!;
-
-    // Fast path: O(1) Map lookup for simple types
-    const simpleCtor = Julia.simpleTypeConstructors.get(typePtr);
-    if (simpleCtor) {
-      return finish(simpleCtor(ptr));
-    }
-
-    // Special types that need extra logic
-    if (typePtr === Julia.Symbol.ptr) {
-      const namePtr = jlbun.symbols.jl_symbol_name_getter(ptr);
-      if (namePtr === null) {
-        throw new Error(
-          "Failed to get symbol name pointer from Julia symbol object",
-        );
-      }
-      return finish(new JuliaSymbol(ptr, namePtr.toString()));
-    }
-    if (jlbun.symbols.jl_is_function_value(ptr) === 1) {
-      const typeStr = jlbun.symbols.jl_typeof_str(ptr).toString();
-      return finish(
-        new JuliaFunction(ptr, Julia.functionNameFromType(typeStr)),
-      );
-    }
-    if (typePtr === Julia.Module.ptr) {
-      return finish(new JuliaModule(ptr, Julia.unsafeString(ptr)));
-    }
-    if (typePtr === Julia.DataType.ptr) {
-      return finish(new JuliaDataType(ptr, Julia.unsafeString(ptr)));
-    }
-
-    // Get type string (cached)
-    let typeStr = Julia.typeStrCache.get(typePtr);
-    if (typeStr === undefined) {
-      typeStr = jlbun.symbols.jl_typeof_str(ptr).toString();
-      Julia.typeStrCache.set(typePtr, typeStr);
+  /**
+   * Wrap many pointers at once. All of them are rooted in the active scope
+   * with a single bulk push instead of one push per value.
+   *
+   * The pointers must be kept alive by the caller until this returns (e.g.
+   * by a rooted `Vector{Any}` holding them, see `Julia.wrapVector`).
+   *
+   * @internal
+   */
+  public static wrapPtrs(ptrs: BigUint64Array): JuliaValue[] {
+    const scope = Julia.requireActiveScope("Julia.wrapPtr");
+    const n = ptrs.length;
+    if (!scope.isTrackingEnabled) {
+      return Array.from(ptrs, (p) => {
+        const value = Julia.unsafeWrapPtr(Number(p) as Pointer);
+        if (!isPersistentJuliaValue(value)) {
+          setJuliaOwnership(value, { kind: "untracked", scope });
+        }
+        return value;
+      });
     }
 
-    // Handle parametric types by type string
-    switch (typeStr) {
-      case "UnionAll":
-        return finish(new JuliaDataType(ptr, Julia.unsafeString(ptr)));
-      case "Array": {
-        const elType = jlbun.symbols.jl_array_eltype(ptr)!;
-        return finish(
-          new JuliaArray(
-            ptr,
-            new JuliaDataType(elType, Julia.getTypeStr(elType)),
-          ),
-        );
+    const idxs = scope.protectPointers(ptrs);
+    const values = new Array<JuliaValue>(n);
+    const persistent: number[] = [];
+    for (let i = 0; i < n; i++) {
+      const value = Julia.unsafeWrapPtr(Number(ptrs[i]) as Pointer);
+      if (isPersistentJuliaValue(value)) {
+        persistent.push(idxs[i]);
+        values[i] = value;
+      } else {
+        values[i] = scope.adopt(value, idxs[i]);
       }
-      case "Tuple":
-        return finish(new JuliaTuple(ptr));
-      case "Pair":
-        return finish(new JuliaPair(ptr));
-      case "NamedTuple":
-        return finish(new JuliaNamedTuple(ptr));
-      case "Ptr":
-        return finish(new JuliaPtr(ptr));
-    }
-
-    // Handle parametric collection types
-    if (typeStr === "Set" || typeStr.startsWith("Set{")) {
-      return finish(new JuliaSet(ptr));
     }
-    if (typeStr === "Dict" || typeStr.startsWith("Dict{")) {
-      return finish(new JuliaDict(ptr));
-    }
-    if (typeStr === "IdDict" || typeStr.startsWith("IdDict{")) {
-      return finish(new JuliaIdDict(ptr));
+    if (persistent.length > 0) {
+      scope.releaseProtectedPointers(persistent);
     }
+    return values;
+  }
 
-    // Handle Range types (UnitRange, StepRange, StepRangeLen, LinRange)
-    if (
-      typeStr === "UnitRange" ||
-      typeStr.startsWith("UnitRange{") ||
-      typeStr === "StepRange" ||
-      typeStr.startsWith("StepRange{") ||
-      typeStr === "StepRangeLen" ||
-      typeStr.startsWith("StepRangeLen{") ||
-      typeStr === "LinRange" ||
-      typeStr.startsWith("LinRange{")
-    ) {
-      return finish(new JuliaRange(ptr));
+  /**
+   * Wrap the first `length` elements of a `Vector{Any}` returned by a C
+   * helper. The vector itself is only rooted while its elements are wrapped.
+   *
+   * @internal
+   */
+  public static wrapVector(vec: Pointer, length: number): JuliaValue[] {
+    if (length === 0) {
+      return [];
     }
-
-    // Handle SubArray type
-    if (typeStr === "SubArray" || typeStr.startsWith("SubArray{")) {
-      const elTypePtr = jlbun.symbols.jl_array_eltype(ptr);
-      if (elTypePtr === null) {
-        return finish(new JuliaAny(ptr));
-      }
-      return finish(
-        new JuliaSubArray(
-          ptr,
-          new JuliaDataType(elTypePtr, Julia.getTypeStr(elTypePtr)),
-        ),
+    const scope = Julia.requireActiveScope("Julia.wrapPtr");
+    const tracking = scope.isTrackingEnabled;
+    const idx = tracking ? scope.protectPointer(vec) : -1;
+    try {
+      const dataPtr = jlbun.symbols.jl_array_data_getter(vec)!;
+      const ptrs = new BigUint64Array(
+        toArrayBuffer(dataPtr, 0, 8 * length).slice(0),
       );
-    }
-
-    // Handle Complex types (ComplexF64, ComplexF32, ComplexF16)
-    // Note: jl_typeof_str returns "Complex" for all Complex types
-    if (
-      typeStr === "Complex" ||
-      typeStr === "ComplexF64" ||
-      typeStr === "ComplexF32" ||
-      typeStr === "ComplexF16" ||
-      typeStr.startsWith("Complex{")
-    ) {
-      // Get element type by checking type parameter (Complex{T} -> T)
-      const elTypePtr = jlbun.symbols.jl_tparam0_getter(typePtr);
-      if (elTypePtr !== null) {
-        // Compare element type pointer to known float types
-        if (elTypePtr === Julia.Float64.ptr) {
-          return finish(JuliaComplex.wrap(ptr, "ComplexF64"));
-        } else if (elTypePtr === Julia.Float32.ptr) {
-          return finish(JuliaComplex.wrap(ptr, "ComplexF32"));
-        } else if (elTypePtr === Julia.Float16.ptr) {
-          return finish(JuliaComplex.wrap(ptr, "ComplexF16"));
-        }
+      return Julia.wrapPtrs(ptrs);
+    } finally {
+      // In perf mode the vector stays on the stack below its elements
+      if (tracking && !scope.isPerfMode) {
+        scope.releaseProtectedPointer(idx);
       }
-      // Unsupported complex type (e.g., Complex{Int64}) - fall through to JuliaAny
     }
+  }
 
-    // Handle lambda functions (type starts with #)
-    if (typeStr[0] === "#") {
-      return finish(
-        new JuliaFunction(ptr, Julia.functionNameFromType(typeStr)),
-      );
-    }
+  private static unsafeWrapPtr(ptr: Pointer): JuliaValue {
+    const typePtr = jlbun.symbols.jl_typeof_getter(ptr)!;
 
-    return finish(new JuliaAny(ptr));
+    // Fast path: O(1) Map lookup by type pointer
+    let ctor = Julia.simpleTypeConstructors.get(typePtr);
+    if (ctor === undefined) {
+      // First value of this type: classify it by type name in C and cache
+      // the constructor for the type
+      const kind = jlbun.symbols.jlbun_classify_type(
+        typePtr,
+        Julia.classifyParam,
+      ) as WrapperKind;
+      const param = Number(Julia.classifyParam[0]) as Pointer;
+      ctor = Julia.wrapperFactories[kind](ptr, param === 0 ? null : param);
+      Julia.simpleTypeConstructors.set(typePtr, ctor);
+    }
+    return Julia.markRuntimePointerValue(ctor(ptr));
   }
 
   /**
@@ -865,17 +1276,16 @@ export class Julia {
     // eslint-disable-next-line @typescript-eslint/no-explicit-any
     ...args: any[]
   ): JuliaFunction {
-    const kwsorter = Julia.Core.kwfunc(func);
     const wrappedKwargs =
       kwargs instanceof JuliaNamedTuple ? kwargs : JuliaNamedTuple.from(kwargs);
-    const wrappedArgs = args.map(Julia.autoWrap);
+    const wrappedArgs = Julia.autoWrapMany(args);
     if (wrappedKwargs.length > 0) {
       wrappedArgs.splice(0, 0, wrappedKwargs, func);
     }
 
     const wrappedFunc = Julia.tagEval`
       let
-          func = ${wrappedKwargs.length > 0 ? kwsorter : func}
+          func = ${wrappedKwargs.length > 0 ? Julia.Core.kwcall : func}
           args = ${wrappedArgs}
           return () -> func(args...)
       end` as JuliaFunction;
@@ -983,7 +1393,7 @@ export class Julia {
     func: JuliaValue & { name?: string },
     args: unknown[],
   ): JuliaValue | undefined {
-    const wrappedArgValues = args.map((arg) => Julia.autoWrap(arg));
+    const wrappedArgValues = Julia.autoWrapMany(args);
     return Julia.invokeCall(func, args, wrappedArgValues, false);
   }
 
@@ -1033,6 +1443,39 @@ export class Julia {
     }
   }
 
+  /**
+   * Record several Julia calls and execute them in a single FFI crossing.
+   *
+   * Calls recorded through `b.call()` return `JuliaBatchSlot` references,
+   * which can be passed as the callee or arguments of later calls in the same
+   * batch. Intermediate results stay on the Julia side and are rooted by the
+   * batch while it runs.
+   *
+   * If a call throws, the remaining calls are skipped and the error is
+   * reported for the first failing call, with its index in the message.
+   *
+   * @param fn Callback recording the calls.
+   * @returns The results of all recorded calls, in recording order.
+   *
+   * @example
+   * ```typescript
+   * Julia.scope((julia) => {
+   *   const [, , total] = julia.batch((b) => {
+   *     const xs = b.call(julia.Base.rand, 1000);
+   *     const ys = b.call(julia.Base.map, julia.Base.sqrt, xs);
+   *     b.call(julia.Base.sum, ys);
+   *   });
+   *   return total.value;
+   * });
+   * ```
+   */
+  public static batch(fn: (batch: JuliaBatch) => void): JuliaValue[] {
+    Julia.requireActiveScope("Julia.batch");
+    const batch = new JuliaBatch();
+    fn(batch);
+    return batch.execute();
+  }
+
   /**
    * Call a Julia function with keyword arguments and variable arguments.
    *
@@ -1058,17 +1501,23 @@ export class Julia {
     // eslint-disable-next-line @typescript-eslint/no-explicit-any
     args: any[],
   ): JuliaValue {
-    const kwsorter = Julia.Core.kwfunc(func);
-    const wrappedKwargs =
-      kwargs instanceof JuliaNamedTuple ? kwargs : JuliaNamedTuple.from(kwargs);
+    let namesType: Pointer | null = null;
+    let kwValues: JuliaValue[];
+    if (kwargs instanceof JuliaNamedTuple) {
+      kwValues = [kwargs];
+    } else {
+      const keys = Object.keys(kwargs);
+      namesType = namedTupleType(keys);
+      kwValues = Julia.autoWrapMany(keys.map((key) => kwargs[key]));
+    }
 
-    const wrappedArgValues = args.map((arg) => Julia.autoWrap(arg));
+    const wrappedArgValues = Julia.autoWrapMany(args);
     return Julia.invokeCallWithKwargs(
       func,
-      kwsorter,
       kwargs,
       args,
-      wrappedKwargs,
+      namesType,
+      kwValues,
       wrappedArgValues,
       false,
     );
@@ -1081,58 +1530,56 @@ export class Julia {
     // eslint-disable-next-line @typescript-eslint/no-explicit-any
     ...args: any[]
   ): JuliaValue {
-    const kwsorter = Julia.unsafeCall(
-      Julia.getFunction(Julia.Core, "kwfunc"),
-      func,
-    ) as JuliaFunction;
-    const wrappedKwargs =
-      kwargs instanceof JuliaNamedTuple ? kwargs : Julia.unsafeAutoWrap(kwargs);
-    if (!(wrappedKwargs instanceof JuliaNamedTuple)) {
-      throw new MethodError("Keyword arguments must wrap to a NamedTuple");
+    let namesType: Pointer | null = null;
+    let kwValues: JuliaValue[];
+    if (Julia.isPlainObject(kwargs)) {
+      const keys = Object.keys(kwargs);
+      namesType = namedTupleType(keys);
+      kwValues = keys.map((key) => Julia.unsafeAutoWrap(kwargs[key]));
+    } else {
+      const wrappedKwargs =
+        kwargs instanceof JuliaNamedTuple
+          ? kwargs
+          : Julia.unsafeAutoWrap(kwargs);
+      if (!(wrappedKwargs instanceof JuliaNamedTuple)) {
+        throw new MethodError("Keyword arguments must wrap to a NamedTuple");
+      }
+      kwValues = [wrappedKwargs];
     }
     const wrappedArgValues = args.map((arg) => Julia.unsafeAutoWrap(arg));
     return Julia.invokeCallWithKwargs(
       func,
-      kwsorter,
       kwargs,
       args,
-      wrappedKwargs,
+      namesType,
+      kwValues,
       wrappedArgValues,
       true,
     );
   }
 
+  // Build the keyword arguments and call `Core.kwcall` in one crossing.
+  // `kwValues` are the values for the key set of `namesType`, or a single
+  // `NamedTuple` if `namesType` is null.
   private static invokeCallWithKwargs(
     func: JuliaFunction,
-    kwsorter: JuliaFunction,
     // eslint-disable-next-line @typescript-eslint/no-explicit-any
     kwargs: JuliaNamedTuple | Record<string, any>,
     // eslint-disable-next-line @typescript-eslint/no-explicit-any
     args: any[],
-    wrappedKwargs: JuliaNamedTuple,
+    namesType: Pointer | null,
+    kwValues: JuliaValue[],
     wrappedArgValues: JuliaValue[],
     unsafe: boolean,
   ): JuliaValue {
-    const wrappedArgs = wrappedArgValues.map((arg) => arg.ptr);
-
-    let ret: Pointer | null;
-    if (args.length == 0) {
-      ret = jlbun.symbols.jl_call2(kwsorter.ptr, wrappedKwargs.ptr, func.ptr);
-    } else if (args.length == 1) {
-      ret = jlbun.symbols.jl_call3(
-        kwsorter.ptr,
-        wrappedKwargs.ptr,
-        func.ptr,
-        wrappedArgs[0],
-      );
-    } else {
-      wrappedArgs.splice(0, 0, wrappedKwargs.ptr, func.ptr);
-      ret = jlbun.symbols.jl_call(
-        kwsorter.ptr,
-        new BigInt64Array(wrappedArgs.map(BigInt)),
-        args.length + 2,
-      );
-    }
+    const ret = jlbun.symbols.jlbun_call_kwargs(
+      namesType,
+      Julia.pointerArray(kwValues),
+      kwValues.length,
+      func.ptr,
+      Julia.pointerArray(wrappedArgValues),
+      wrappedArgValues.length,
+    );
 
     if (ret === null) {
       Julia.handleCallException(func, args, kwargs, unsafe);
@@ -1146,12 +1593,54 @@ export class Julia {
    * Evaluate a Julia code fragment and get the result as a `JuliaValue`.
    *
    * @param code Julia code to be evaluated.
+   * @param options Pass `{ cache: true }` for code evaluated many times.
    */
-  public static eval(code: string): JuliaValue {
+  public static eval(code: string, options: EvalOptions = {}): JuliaValue {
     Julia.requireActiveScope("Julia.eval");
+    if (options.cache) {
+      const thunk = Julia.cachedThunk(code);
+      if (thunk !== null) {
+        return Julia.call(thunk)!;
+      }
+    }
     return Julia.unsafeEval(code, false);
   }
 
+  // Compile code with `nargs` placeholders into a function, or null if it
+  // has to be evaluated at top level
+  private static compileTemplate(
+    code: string,
+    nargs: number,
+  ): JuliaFunction | null {
+    const compile = juliaHelper("template", TEMPLATE_HELPER);
+    const compiled = Julia.unsafeCall(compile, code, nargs);
+    if (!(compiled instanceof JuliaFunction)) {
+      return null;
+    }
+    // The closure type is bound in `Main` and roots its instance
+    Julia.markRuntimeValues(compiled);
+    return compiled;
+  }
+
+  private static cachedThunk(code: string): JuliaFunction | null {
+    let thunk = Julia.evalCache.get(code);
+    if (thunk !== undefined) {
+      Julia.evalCache.delete(code);
+    } else {
+      thunk = Julia.compileTemplate(code, 0);
+      if (Julia.evalCache.size >= Julia.evalCacheCapacity) {
+        const [oldest, evicted] = Julia.evalCache.entries().next().value!;
+        Julia.evalCache.delete(oldest);
+        // Only forgets the wrapper: the thunk's type stays bound in `Main`
+        if (evicted !== null) {
+          Julia.runtimeRootPtrs.delete(evicted.ptr);
+        }
+      }
+    }
+    Julia.evalCache.set(code, thunk);
+    return thunk;
+  }
+
   private static unsafeEval(code: string, unsafe = true): JuliaValue {
     const cCode = safeCString(code);
     const ret = jlbun.symbols.jl_eval_string(cCode)!;
@@ -1164,6 +1653,12 @@ export class Julia {
    * This method supports value-interpolation, meaning that the tagged
    * values will be automatically wrapped and interpolated into the code.
    *
+   * The first evaluation of a template compiles it into a function taking
+   * the tagged values as arguments, cached for the template, so later
+   * evaluations only pass new values. Templates that only work at top level
+   * (definitions, imports, macros, assignments to globals) are evaluated
+   * with the values bound to temporary globals instead.
+   *
    * @param strings Strings separated by tagged values
    * @param values Tagged values to be interpolated
    */
@@ -1173,6 +1668,18 @@ export class Julia {
     ...values: any[]
   ): JuliaValue {
     Julia.requireActiveScope("Julia.tagEval");
+    let compiled = Julia.compiledTemplates.get(strings);
+    if (compiled === undefined) {
+      const code = strings.reduce(
+        (code, part, i) => `${code}__jlbun_arg_${i}__${part}`,
+      );
+      compiled = Julia.compileTemplate(code, values.length);
+      Julia.compiledTemplates.set(strings, compiled);
+    }
+    if (compiled !== null) {
+      return Julia.call(compiled, ...values)!;
+    }
+
     const uuids = Array.from(
       { length: values.length },
       () => `${randomUUID()}`,
@@ -1415,6 +1922,9 @@ export class Julia {
    * @param status Status code to be reported.
    */
   public static close(status = 0) {
+    closeTaskPoller();
+    closeRpc();
+    closeHotBindings();
     GCManager.close();
     jlbun.symbols.jl_atexit_hook(status);
     jlbun.close();
@@ -14,6 +14,7 @@ import {
   isPersistentJuliaValue,
   markJuliaRuntimeValue,
 } from "./ownership.js";
+import { recordHotBinding } from "./prefetch.js";
 
 export const JULIA_MODULE_CACHE = Symbol("jlbun.module.cache");
 
@@ -75,6 +76,7 @@ export class JuliaModule implements JuliaValue {
     const value = Julia.wrapPtr(sym);
     if (isPersistentJuliaValue(value)) {
       cache.set(prop, value);
+      recordHotBinding(this.name, prop);
     } else if (
       value instanceof JuliaFunction ||
       value instanceof JuliaDataType ||
@@ -90,6 +92,7 @@ export class JuliaModule implements JuliaValue {
       }
       markJuliaRuntimeValue(value);
       cache.set(prop, value);
+      recordHotBinding(this.name, prop);
     }
     return value;
   }
@@ -39,10 +39,15 @@ export function setJuliaOwnership<T extends JuliaValue>(
   value: T,
   ownership: JuliaOwnership,
 ): T {
+  // Keep an external owner (e.g. a shared buffer) across ownership changes
+  const owner = getJuliaOwnership(value)?.owner;
   Object.defineProperty(value, JULIA_OWNERSHIP, {
     configurable: true,
     enumerable: false,
-    value: ownership,
+    value:
+      owner !== undefined && ownership.owner === undefined
+        ? { ...ownership, owner }
+        : ownership,
     writable: true,
   });
   return value;
@@ -0,0 +1,117 @@
+import {
+  Julia,
+  JuliaArray,
+  JuliaFunction,
+  JuliaTask,
+  JuliaValue,
+} from "./index.js";
+import { juliaHelper } from "./utils.js";
+
+/**
+ * Options of `Julia.parallel.map()`.
+ */
+export interface ParallelMapOptions {
+  /**
+   * Number of chunks the array is split into, each mapped by its own task.
+   * Defaults to `Julia.nthreads`.
+   */
+  chunks?: number;
+  /**
+   * Preallocated output with the same axes as the input. By default, a new
+   * array with the inferred element type of `f` is allocated.
+   */
+  out?: JuliaArray;
+}
+
+/**
+ * Options of `Julia.parallel.reduce()`.
+ */
+export interface ParallelReduceOptions {
+  /**
+   * Number of chunks the array is split into, each reduced by its own task.
+   * Defaults to `Julia.nthreads`.
+   */
+  chunks?: number;
+}
+
+// Allocate and check the output on the calling thread, so that errors are
+// thrown by the call itself, then return a task that maps the chunks in
+// `Threads.@spawn` tasks and waits for them. The task is left unscheduled,
+// like `Threads.@spawn` would before queueing it, for `JuliaTask.value`.
+const PARALLEL_MAP = `(f, xs, out, nchunks) -> begin
+  out = out === nothing ? similar(xs, Base.promote_op(f, eltype(xs))) : out
+  axes(out) == axes(xs) || throw(DimensionMismatch(
+    "output axes $(axes(out)) do not match input axes $(axes(xs))"))
+  task = Task() do
+    len = max(cld(length(xs), nchunks), 1)
+    workers = map(Iterators.partition(eachindex(xs, out), len)) do c
+      Threads.@spawn map!(f, view(out, c), view(xs, c))
+    end
+    foreach(wait, workers)
+    out
+  end
+  task.sticky = false
+  task
+end`;
+
+// Reduce each chunk in its own task, then combine the partial results
+const PARALLEL_REDUCE = `(op, f, xs, nchunks) -> begin
+  task = Task() do
+    len = max(cld(length(xs), nchunks), 1)
+    workers = map(Iterators.partition(eachindex(xs), len)) do c
+      Threads.@spawn mapreduce(f, op, view(xs, c))
+    end
+    mapreduce(fetch, op, workers)
+  end
+  task.sticky = false
+  task
+end`;
+
+function chunkCount(chunks: number | undefined): number {
+  const n = chunks ?? Julia.nthreads;
+  if (!Number.isSafeInteger(n) || n < 1) {
+    throw new RangeError(`chunks must be a positive integer, got ${n}`);
+  }
+  return n;
+}
+
+/**
+ * Implementation of `Julia.parallel.map()`.
+ *
+ * @internal
+ */
+export function parallelMap(
+  f: JuliaFunction,
+  array: JuliaArray,
+  options: ParallelMapOptions = {},
+): Promise<JuliaArray> {
+  const task = Julia.call(
+    juliaHelper("parallel_map", PARALLEL_MAP),
+    f,
+    array,
+    options.out,
+    chunkCount(options.chunks),
+  ) as JuliaTask;
+  return task.value as Promise<JuliaArray>;
+}
+
+/**
+ * Implementation of `Julia.parallel.reduce()`.
+ *
+ * @internal
+ */
+export function parallelReduce(
+  op: JuliaFunction,
+  f: JuliaFunction,
+  array: JuliaArray,
+  options: ParallelReduceOptions = {},
+): Promise<JuliaValue> {
+  const task = Julia.call(
+    juliaHelper("parallel_reduce", PARALLEL_REDUCE),
+    op,
+    f,
+    array,
+    chunkCount(options.chunks),
+  ) as JuliaTask;
+  return task.value;
+}
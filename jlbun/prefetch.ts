@@ -0,0 +1,116 @@
+import { existsSync, readFileSync, writeFileSync } from "fs";
+import { Julia, JuliaModule } from "./index.js";
+
+// Bindings warmed per tick of the background warm-up
+const WARM_CHUNK = 32;
+
+// File the hot bindings are loaded from and saved to, if recording
+let hotBindingsPath: string | null = null;
+// `Module.name` of every binding loaded or looked up in this run
+const hotBindings: Set<string> = new Set();
+let warmTimer: ReturnType<typeof setTimeout> | null = null;
+
+/**
+ * Record a module binding that was looked up and cached, so that the next
+ * run can warm it before it is needed.
+ *
+ * @internal
+ */
+export function recordHotBinding(module: string, prop: string): void {
+  if (hotBindingsPath !== null) {
+    hotBindings.add(`${module}.${prop}`);
+  }
+}
+
+// Resolve a module from its name, e.g. `Base.Threads`. Modules other than
+// the roots must be reachable from `Main`.
+function resolveModule(name: string): JuliaModule | null {
+  const [root, ...path] = name.split(".");
+  let module: unknown =
+    root === "Core"
+      ? Julia.Core
+      : root === "Base"
+        ? Julia.Base
+        : root === "Main"
+          ? Julia.Main
+          : Julia.Main.lookup(root);
+  for (const prop of path) {
+    if (!(module instanceof JuliaModule)) {
+      return null;
+    }
+    module = module.lookup(prop);
+  }
+  return module instanceof JuliaModule ? module : null;
+}
+
+function warmChunk(pending: string[]): void {
+  warmTimer = null;
+  Julia.scope(() => {
+    for (const binding of pending.splice(0, WARM_CHUNK)) {
+      const dot = binding.lastIndexOf(".");
+      try {
+        resolveModule(binding.slice(0, dot))?.lookup(binding.slice(dot + 1));
+      } catch (_) {
+        // The binding no longer exists; it is dropped on the next save
+        hotBindings.delete(binding);
+      }
+    }
+  });
+  if (pending.length > 0) {
+    warmTimer = setTimeout(() => warmChunk(pending), 0);
+    warmTimer.unref?.();
+  }
+}
+
+/**
+ * Start recording hot bindings to `path`, and warm the bindings recorded by
+ * a previous run in the background, a chunk per tick.
+ *
+ * @internal
+ */
+export function loadHotBindings(path: string): void {
+  hotBindingsPath = path;
+  if (!existsSync(path)) {
+    return;
+  }
+  let bindings: unknown;
+  try {
+    bindings = JSON.parse(readFileSync(path, "utf8"));
+  } catch (_) {
+    return;
+  }
+  if (!Array.isArray(bindings)) {
+    return;
+  }
+  const pending = bindings.filter(
+    (binding): binding is string =>
+      typeof binding === "string" && binding.includes("."),
+  );
+  pending.forEach((binding) => hotBindings.add(binding));
+  if (pending.length > 0) {
+    warmTimer = setTimeout(() => warmChunk(pending), 0);
+    warmTimer.unref?.();
+  }
+}
+
+/**
+ * Stop warming, and save the hot bindings of this run if recording.
+ *
+ * @internal
+ */
+export function closeHotBindings(): void {
+  if (warmTimer !== null) {
+    clearTimeout(warmTimer);
+    warmTimer = null;
+  }
+  if (hotBindingsPath === null) {
+    return;
+  }
+  try {
+    writeFileSync(hotBindingsPath, JSON.stringify([...hotBindings].sort()));
+  } catch (_) {
+    // Recording is best effort; a read-only location only loses the hints
+  }
+  hotBindingsPath = null;
+  hotBindings.clear();
+}
@@ -0,0 +1,278 @@
+import { Pointer } from "bun:ffi";
+import {
+  createJuliaError,
+  jlbun,
+  Julia,
+  JuliaFunction,
+  JuliaTask,
+  JuliaValue,
+} from "./index.js";
+import { JuliaScope, runWithJuliaScope } from "./scope.js";
+
+/**
+ * Options of `Julia.rpc.start()`.
+ */
+export interface RpcOptions {
+  /**
+   * Number of worker tasks. Defaults to `Julia.nthreads - 1` (at least 1),
+   * so that the main thread, which runs JS, stays free.
+   */
+  workers?: number;
+  /**
+   * Maximum number of calls in flight, rounded up to a power of two. Further
+   * calls wait in a JS queue until a slot is released. Defaults to 1024.
+   */
+  capacity?: number;
+}
+
+// Interval of the completion drain, in milliseconds
+const RPC_DRAIN_INTERVAL = 1;
+// Completions drained per FFI crossing
+const RPC_DRAIN_BATCH = 256;
+
+interface PendingCall {
+  scope: JuliaScope;
+  resolve: (value: JuliaValue) => void;
+  reject: (reason: unknown) => void;
+}
+
+interface QueuedCall extends PendingCall {
+  f: JuliaFunction;
+  args: JuliaValue[];
+}
+
+// Calls submitted to the workers, by slot
+const pendingCalls: Map<number, PendingCall> = new Map();
+// Calls waiting for a free slot, in submission order
+const backlog: QueuedCall[] = [];
+const drainedSlots = new BigInt64Array(RPC_DRAIN_BATCH);
+const drainedValues = new BigUint64Array(RPC_DRAIN_BATCH);
+const drainedFailed = new Uint8Array(RPC_DRAIN_BATCH);
+let drainTimer: ReturnType<typeof setInterval> | null = null;
+// Task finishing with the workers; rooted on the Julia side until restart
+let workersDone: Pointer | null = null;
+// Set by `rpcStop()` until the workers have exited
+let stopping: Promise<void> | null = null;
+let mainThreadWorkers = false;
+let idleWaiters: (() => void)[] = [];
+
+// Submit a call; false if every slot is in use
+function submit(call: QueuedCall): boolean {
+  if (call.scope.isDisposed) {
+    // The arguments may have been unrooted with the scope
+    call.reject(new Error("The JuliaScope making this call was disposed"));
+    return true;
+  }
+  const args = new BigUint64Array(Math.max(call.args.length, 1));
+  for (let i = 0; i < call.args.length; i++) {
+    args[i] = BigInt(call.args[i].ptr);
+  }
+  const slot = Number(
+    jlbun.symbols.jlbun_rpc_submit(call.f.ptr, args, call.args.length),
+  );
+  if (slot === -1) {
+    return false;
+  }
+  if (slot < 0) {
+    call.reject(new Error("The Julia RPC pool is not running"));
+    return true;
+  }
+  const { scope, resolve, reject } = call;
+  pendingCalls.set(slot, { scope, resolve, reject });
+  return true;
+}
+
+// Settle a finished call inside the scope that made it. The result is still
+// rooted by its slot until the slot is released.
+function settleCall(slot: number, ptr: Pointer, failed: boolean): void {
+  const pending = pendingCalls.get(slot)!;
+  pendingCalls.delete(slot);
+  const { scope, resolve, reject } = pending;
+  if (scope.isDisposed) {
+    reject(new Error("The JuliaScope awaiting this call was disposed"));
+    return;
+  }
+  runWithJuliaScope(scope, () => {
+    try {
+      const value = Julia.wrapPtr(ptr);
+      if (failed) {
+        const errType = Julia.getTypeStr(value);
+        reject(createJuliaError(errType, Julia.string(value)));
+      } else {
+        resolve(value);
+      }
+    } catch (err) {
+      reject(err);
+    }
+  });
+}
+
+// Drain finished calls in batches, then refill freed slots from the backlog;
+// runs on a timer while any call is pending
+function drainCalls(): void {
+  // Only the first drain of a tick yields to workers on the main thread
+  let yieldToJulia = mainThreadWorkers ? 1 : 0;
+  for (;;) {
+    const n = Number(
+      jlbun.symbols.jlbun_rpc_drain(
+        drainedSlots,
+        drainedValues,
+        drainedFailed,
+        RPC_DRAIN_BATCH,
+        yieldToJulia,
+      ),
+    );
+    yieldToJulia = 0;
+    for (let i = 0; i < n; i++) {
+      settleCall(
+        Number(drainedSlots[i]),
+        Number(drainedValues[i]) as Pointer,
+        drainedFailed[i] !== 0,
+      );
+    }
+    if (n > 0) {
+      jlbun.symbols.jlbun_rpc_release(drainedSlots, n);
+    }
+    while (backlog.length > 0 && submit(backlog[0])) {
+      backlog.shift();
+    }
+    if (n < RPC_DRAIN_BATCH) {
+      break;
+    }
+  }
+  if (pendingCalls.size === 0 && backlog.length === 0) {
+    if (drainTimer !== null) {
+      clearInterval(drainTimer);
+      drainTimer = null;
+    }
+    const waiters = idleWaiters;
+    idleWaiters = [];
+    waiters.forEach((resolve) => resolve());
+  }
+}
+
+/**
+ * Implementation of `Julia.rpc.running`.
+ *
+ * @internal
+ */
+export function rpcRunning(): boolean {
+  return workersDone !== null;
+}
+
+/**
+ * Implementation of `Julia.rpc.start()`.
+ *
+ * @internal
+ */
+export function rpcStart(options: RpcOptions = {}): void {
+  if (workersDone !== null) {
+    throw new Error("The Julia RPC pool is already running");
+  }
+  if (stopping !== null) {
+    throw new Error(
+      "The Julia RPC pool is still stopping; await Julia.rpc.stop() first",
+    );
+  }
+  const workers = options.workers ?? Math.max(Julia.nthreads - 1, 1);
+  const capacity = options.capacity ?? 1024;
+  if (!Number.isSafeInteger(workers) || workers < 1) {
+    throw new RangeError(`workers must be a positive integer, got ${workers}`);
+  }
+  if (!Number.isSafeInteger(capacity) || capacity < 1) {
+    throw new RangeError(
+      `capacity must be a positive integer, got ${capacity}`,
+    );
+  }
+  const ptr = jlbun.symbols.jlbun_rpc_start(capacity, workers);
+  if (ptr === null) {
+    const errPtr = jlbun.symbols.jl_exception_occurred();
+    const message = "Failed to start the Julia RPC pool";
+    throw errPtr === null
+      ? new Error(message)
+      : createJuliaError(Julia.getTypeStr(errPtr), message);
+  }
+  workersDone = ptr;
+  mainThreadWorkers = Julia.nthreads === 1;
+}
+
+/**
+ * Implementation of `Julia.rpc.call()`.
+ *
+ * @internal
+ */
+export function rpcCall(
+  f: JuliaFunction,
+  ...args: unknown[]
+): Promise<JuliaValue> {
+  if (workersDone === null) {
+    return Promise.reject(new Error("The Julia RPC pool is not running"));
+  }
+  let scope: JuliaScope;
+  let wrappedArgs: JuliaValue[];
+  try {
+    // Results are adopted by the calling scope when the call settles
+    scope = Julia.requireActiveScope("Julia.rpc.call");
+    wrappedArgs = Julia.autoWrapMany(args);
+  } catch (error) {
+    return Promise.reject(error);
+  }
+  return new Promise((resolve, reject) => {
+    const call = { f, args: wrappedArgs, scope, resolve, reject };
+    if (backlog.length > 0 || !submit(call)) {
+      backlog.push(call);
+    }
+    drainTimer ??= setInterval(drainCalls, RPC_DRAIN_INTERVAL);
+  });
+}
+
+/**
+ * Implementation of `Julia.rpc.stop()`.
+ *
+ * @internal
+ */
+export function rpcStop(): Promise<void> {
+  const done = workersDone;
+  if (done === null) {
+    return stopping ?? Promise.resolve();
+  }
+  workersDone = null;
+  stopping = (async () => {
+    try {
+      if (pendingCalls.size > 0 || backlog.length > 0) {
+        await new Promise<void>((resolve) => idleWaiters.push(resolve));
+      }
+      jlbun.symbols.jlbun_rpc_stop();
+      await Julia.scopeAsync(async () => {
+        const task = Julia.adoptValue(new JuliaTask(done));
+        // Already spawned: only wait for it
+        task.scheduled = true;
+        await task.value;
+      });
+    } finally {
+      stopping = null;
+    }
+  })();
+  return stopping;
+}
+
+/**
+ * Stop draining and reject every pending `Julia.rpc.call()`.
+ *
+ * @internal
+ */
+export function closeRpc(): void {
+  if (drainTimer !== null) {
+    clearInterval(drainTimer);
+    drainTimer = null;
+  }
+  for (const { reject } of [...pendingCalls.values(), ...backlog]) {
+    reject(new Error("Julia was closed before the call finished"));
+  }
+  pendingCalls.clear();
+  backlog.length = 0;
+  if (workersDone !== null) {
+    workersDone = null;
+    jlbun.symbols.jlbun_rpc_stop();
+  }
+}
@@ -1,9 +1,11 @@
 import { Pointer } from "bun:ffi";
 import { AsyncLocalStorage } from "node:async_hooks";
 import {
+  EvalOptions,
   GCManager,
   Julia,
   JuliaArray,
+  JuliaBatch,
   JuliaDataType,
   JuliaDict,
   JuliaFunction,
@@ -134,7 +136,7 @@ export interface ScopedJulia {
   /** Proxy for creating auto-tracked JuliaNamedTuples */
   readonly NamedTuple: ScopedJuliaNamedTuple;
 
-  eval(code: string): JuliaValue;
+  eval(code: string, options?: EvalOptions): JuliaValue;
   tagEval(strings: TemplateStringsArray, ...values: unknown[]): JuliaValue;
   import(name: string): JuliaModule;
   call(fn: JuliaFunction, ...args: unknown[]): JuliaValue | undefined;
@@ -143,6 +145,11 @@ export interface ScopedJulia {
     kwargs: JuliaNamedTuple | Record<string, unknown>,
     ...args: unknown[]
   ): JuliaValue;
+  /**
+   * Record several calls and execute them in a single FFI crossing.
+   * See `Julia.batch()`.
+   */
+  batch(fn: (batch: JuliaBatch) => void): JuliaValue[];
 
   track<T extends JuliaValue>(value: T): T;
   escape<T extends JuliaValue>(value: T): T;
@@ -266,9 +273,15 @@ export class JuliaScope {
   private disposed = false;
   private trackingEnabled = true;
   private mode: ScopeMode;
+  private escapedCount = 0;
+  // Creation time, only recorded while GCManager.onScopeSummary is set
+  private startTime: number | undefined;
 
   constructor(options: JuliaScopeOptions = {}) {
     this.mode = options.mode ?? "default";
+    if (GCManager.onScopeSummary !== null) {
+      this.startTime = performance.now();
+    }
 
     if (this.mode === "perf") {
       // Perf mode: ensure perf GC is initialized, then mark current position
@@ -355,6 +368,33 @@ export class JuliaScope {
     return idx;
   }
 
+  /**
+   * Root many raw Julia pointers in this scope with a single bulk push.
+   *
+   * @returns The root slot of each pointer
+   * @internal
+   */
+  protectPointers(ptrs: BigUint64Array): number[] {
+    if (this.disposed) {
+      throw new Error("Cannot protect values in a disposed scope");
+    }
+    if (ptrs.length === 0) {
+      return [];
+    }
+    if (this.mode === "perf") {
+      const first = GCManager.perfPushMany(ptrs);
+      if (first < 0) {
+        throw new Error("Failed to protect Julia pointers in scope");
+      }
+      return Array.from({ length: ptrs.length }, (_, i) => first + i);
+    }
+    const idxs = GCManager.pushScopedMany(ptrs, this.scopeId);
+    if (idxs === null) {
+      throw new Error("Failed to protect Julia pointers in scope");
+    }
+    return idxs;
+  }
+
   /**
    * Attach an already-created root slot to a wrapper.
    *
@@ -404,6 +444,19 @@ export class JuliaScope {
     }
   }
 
+  /**
+   * Release raw pointer roots created by protectPointers().
+   * In perf mode the roots stay on the stack until the scope is disposed,
+   * since the perf stack can only be released from a mark to its top.
+   *
+   * @internal
+   */
+  releaseProtectedPointers(idxs: number[]): void {
+    if (this.mode !== "perf") {
+      GCManager.releaseMany(idxs);
+    }
+  }
+
   /**
    * Run a callback with this scope as the active async context.
    *
@@ -458,6 +511,9 @@ export class JuliaScope {
    * @returns The same value
    */
   escape<T extends JuliaValue>(value: T): T {
+    if (this.disposed) {
+      throw new Error("Cannot escape values from a disposed scope");
+    }
     const ownership = getJuliaOwnership(value);
     if (ownership?.kind === "escaped" || ownership?.kind === "runtime") {
       return value;
@@ -481,15 +537,22 @@ export class JuliaScope {
       GCManager.registerEscape(value, idx);
       setJuliaOwnership(value, { kind: "escaped", idx });
     } else {
+      // Released slots are reused, so the index may now root another value
+      if (GCManager.getScope(ownership.idx) !== this.scopeId) {
+        throw new ScopeOwnershipError(
+          "ScopeOwnershipError: value is not owned by an active root slot",
+        );
+      }
       const transferred = GCManager.transfer(ownership.idx, 0n);
       if (transferred < 0) {
         throw new ScopeOwnershipError(
           "ScopeOwnershipError: value is not owned by an active root slot",
         );
       }
-      GCManager.registerEscape(value, ownership.idx);
-      setJuliaOwnership(value, { kind: "escaped", idx: ownership.idx });
+      GCManager.registerEscape(value, transferred);
+      setJuliaOwnership(value, { kind: "escaped", idx: transferred });
     }
+    this.escapedCount++;
     return value;
   }
 
@@ -515,9 +578,18 @@ export class JuliaScope {
     if (this.disposed) return;
     this.disposed = true;
 
+    const summarize = this.startTime !== undefined;
+    const releaseStart = summarize ? performance.now() : 0;
+    let tracked = this.tracked.size;
+    let released = 0;
+
     if (this.mode === "perf") {
       // Perf mode: simple stack release to mark position (O(1))
       // Escaped values are already in default GC stack
+      if (summarize) {
+        released = GCManager.perfSize - this.perfMark;
+        tracked = released;
+      }
       GCManager.perfRelease(this.perfMark);
     } else if (this.mode === "safe") {
       // Safe mode: ALL objects are managed by FinalizationRegistry
@@ -526,18 +598,52 @@ export class JuliaScope {
         const ownership = getJuliaOwnership(value);
         if (ownership?.kind === "scoped" && ownership.scope === this) {
           // Transfer to global scope (id=0) so it won't be released
-          GCManager.transfer(idx, 0n);
-          GCManager.registerEscape(value, idx);
-          setJuliaOwnership(value, { kind: "escaped", idx });
+          const escapedIdx = GCManager.transfer(idx, 0n);
+          if (escapedIdx < 0) {
+            // The slot is no longer active: there is no root to hand over
+            continue;
+          }
+          GCManager.registerEscape(value, escapedIdx);
+          setJuliaOwnership(value, { kind: "escaped", idx: escapedIdx });
+          this.escapedCount++;
         }
       }
     } else {
       // Default mode: release values still belonging to this scope.
       // Escaped values have already been transferred to global scope.
-      GCManager.scopeEnd(this.scopeId);
+      released = GCManager.scopeEnd(this.scopeId);
     }
 
     this.tracked.clear();
+
+    if (summarize) {
+      this.reportSummary(tracked, released, releaseStart);
+    }
+  }
+
+  private reportSummary(
+    tracked: number,
+    released: number,
+    releaseStart: number,
+  ): void {
+    const listener = GCManager.onScopeSummary;
+    if (listener === null) {
+      return;
+    }
+    const now = performance.now();
+    try {
+      listener({
+        scopeId: this.scopeId,
+        mode: this.mode,
+        tracked,
+        escaped: this.escapedCount,
+        released,
+        durationMs: now - this.startTime!,
+        releaseMs: now - releaseStart,
+      });
+    } catch {
+      // Telemetry must not break scope disposal
+    }
   }
 
   /**
@@ -751,8 +857,8 @@ export class JuliaScope {
       Tuple: scopedTuple,
       NamedTuple: scopedNamedTuple,
 
-      eval: (code: string): JuliaValue => {
-        return this.run(() => trackIfNeeded(Julia.eval(code)));
+      eval: (code: string, options?: EvalOptions): JuliaValue => {
+        return this.run(() => trackIfNeeded(Julia.eval(code, options)));
       },
 
       tagEval: (
@@ -782,6 +888,10 @@ export class JuliaScope {
         );
       },
 
+      batch: (fn: (batch: JuliaBatch) => void): JuliaValue[] => {
+        return this.run(() => Julia.batch(fn));
+      },
+
       // Expose scope methods
       track: trackValue,
       escape: escapeValue,
@@ -1,6 +1,13 @@
 /* eslint-disable @typescript-eslint/no-explicit-any */
 import { Pointer } from "bun:ffi";
-import { Julia, JuliaValue } from "./index.js";
+import {
+  columnFromJulia,
+  columnToJulia,
+  columnValues,
+  JuliaColumn,
+} from "./columns.js";
+import { Julia, JuliaArray, JuliaValue } from "./index.js";
+import { juliaHelper } from "./utils.js";
 
 /**
  * Wrapper for Julia `Set`s.
@@ -20,6 +27,22 @@ export class JuliaSet implements JuliaValue {
     return set;
   }
 
+  /**
+   * Create a `Set` from a column of elements in O(1) FFI calls: the column
+   * crosses once, and the set is filled by a single Julia call after
+   * `sizehint!`. The element type is the element type of the column.
+   *
+   * @param values The elements: a `TypedArray`, packed strings or a JS
+   * array.
+   */
+  public static fromColumn(values: JuliaColumn): JuliaSet {
+    const build = juliaHelper(
+      "set_from_column",
+      "xs -> union!(sizehint!(Set{eltype(xs)}(), length(xs)), xs)",
+    );
+    return Julia.call(build, columnToJulia(values)) as JuliaSet;
+  }
+
   has(value: any): boolean {
     return Julia.Base.in(value, this).value;
   }
@@ -41,8 +64,17 @@ export class JuliaSet implements JuliaValue {
     return Number(Julia.Base.length(this).value);
   }
 
+  /**
+   * Copy the elements into a dense column in one pass over the set: a
+   * `TypedArray` for numeric types, packed strings for `String`, and a JS
+   * array otherwise.
+   */
+  toColumn(): JuliaColumn {
+    return columnFromJulia(Julia.Base.collect(this) as JuliaArray);
+  }
+
   get value(): Set<any> {
-    return new Set(Julia.Base.collect(this).value);
+    return new Set(columnValues(this.toColumn()));
   }
 
   toString(): string {
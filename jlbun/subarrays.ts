@@ -1,4 +1,5 @@
 import { Pointer, toArrayBuffer } from "bun:ffi";
+import { TypedArrayConstructor, typedArrayConstructor } from "./arrays.js";
 import {
   BunArray,
   jlbun,
@@ -8,6 +9,46 @@ import {
   JuliaValue,
 } from "./index.js";
 
+// Must match JLBUN_STRIDED_MAX_DIMS in c/wrapper.c
+const STRIDED_MAX_DIMS = 16;
+
+interface TypedLayout {
+  layout: StridedLayout;
+  ctor: TypedArrayConstructor;
+}
+
+/**
+ * Memory layout of a strided SubArray, computed in C from the parent's
+ * dims and the SubArray's indices.
+ *
+ * Element `(i_1, ..., i_n)` (0-based) lives at
+ * `ptr + elsize * (i_1 * strides[0] + ... + i_n * strides[n - 1])`.
+ */
+export interface StridedLayout {
+  /** Address of the first element. */
+  ptr: Pointer;
+  /** Element size in bytes. */
+  elsize: number;
+  shape: number[];
+  /** Strides in elements. May be negative for reversed ranges. */
+  strides: number[];
+  /** Whether the elements are dense in column-major order. */
+  contiguous: boolean;
+}
+
+/**
+ * Zero-copy `TypedArray` over the memory spanned by a strided SubArray.
+ *
+ * Element `(i_1, ..., i_n)` (0-based) is
+ * `data[offset + i_1 * strides[0] + ... + i_n * strides[n - 1]]`.
+ */
+export interface StridedView {
+  data: BunArray;
+  offset: number;
+  shape: number[];
+  strides: number[];
+}
+
 /**
  * Wrapper for Julia `SubArray` - a view into an existing array.
  *
@@ -52,6 +93,16 @@ import {
  * const sub1 = arr.view([2, 8]);     // [3, 4, 5, 6, 7, 8, 9]
  * const sub2 = sub1.view([1, 3]);    // [4, 5, 6]
  * ```
+ *
+ * @example
+ * ```typescript
+ * // Strided access without collecting in Julia
+ * const matrix = JuliaArray.from(new Float64Array(1e6), { shape: [1000, 1000] });
+ * const row = matrix.view(0, ":"); // stride 1000
+ * const { data, offset, strides } = row.stridedView()!; // zero-copy
+ * const copy = new Float64Array(row.length);
+ * row.gatherInto(copy); // one native copy
+ * ```
  */
 export class JuliaSubArray implements JuliaValue {
   ptr: Pointer;
@@ -191,12 +242,153 @@ export class JuliaSubArray implements JuliaValue {
     return result;
   }
 
+  /**
+   * Strided memory layout of the SubArray, or `null` if the parent is not a
+   * dense array of bits types, or an index is not an integer, a colon or an
+   * integer range.
+   *
+   * **Warning**: The layout points into the parent array and becomes invalid
+   * if the parent is garbage collected or resized.
+   */
+  get layout(): StridedLayout | null {
+    const out = new BigInt64Array(3 + 2 * STRIDED_MAX_DIMS);
+    if (jlbun.symbols.jlbun_strided_layout(this.ptr, out) === 0) {
+      return null;
+    }
+    const ndims = Number(out[2]);
+    const shape: number[] = [];
+    const strides: number[] = [];
+    let contiguous = true;
+    let expected = 1;
+    for (let k = 0; k < ndims; k++) {
+      shape.push(Number(out[3 + k]));
+      strides.push(Number(out[3 + STRIDED_MAX_DIMS + k]));
+      // The stride of a dimension of size 1 does not matter
+      if (shape[k] !== 1 && strides[k] !== expected) {
+        contiguous = false;
+      }
+      expected *= shape[k];
+    }
+    return {
+      ptr: Number(out[0]) as Pointer,
+      elsize: Number(out[1]),
+      shape,
+      strides,
+      contiguous,
+    };
+  }
+
+  /**
+   * Strided layout and the matching `TypedArray` constructor, if the
+   * SubArray can be read directly from memory.
+   */
+  private typedLayout(): TypedLayout | null {
+    const ctor = typedArrayConstructor(this.elType);
+    if (ctor === null) {
+      return null;
+    }
+    const layout = this.layout;
+    if (layout === null || layout.elsize !== ctor.BYTES_PER_ELEMENT) {
+      return null;
+    }
+    return { layout, ctor };
+  }
+
+  /**
+   * Get a zero-copy `TypedArray` over the memory spanned by the SubArray,
+   * plus the offset and strides (in elements) needed to index it. For
+   * contiguous SubArrays, `data` holds exactly the elements of the view in
+   * column-major order.
+   *
+   * Returns `null` for non-strided SubArrays and element types without a
+   * `TypedArray` counterpart.
+   *
+   * **Warning**: `data` aliases the parent array's memory and becomes
+   * invalid if the parent is garbage collected or resized.
+   */
+  stridedView(): StridedView | null {
+    const typed = this.typedLayout();
+    return typed === null ? null : JuliaSubArray.viewOf(typed);
+  }
+
+  private static viewOf({ layout, ctor }: TypedLayout): StridedView {
+    const { shape, strides } = layout;
+    if (shape.some((d) => d === 0)) {
+      return { data: new ctor(0), offset: 0, shape, strides };
+    }
+
+    // Extent of the view, in elements relative to the first one
+    let lo = 0;
+    let hi = 0;
+    for (let k = 0; k < shape.length; k++) {
+      const extent = (shape[k] - 1) * strides[k];
+      if (extent < 0) {
+        lo += extent;
+      } else {
+        hi += extent;
+      }
+    }
+    const start = (layout.ptr + lo * layout.elsize) as Pointer;
+    const data = new ctor(
+      toArrayBuffer(start, 0, (hi - lo + 1) * layout.elsize),
+    );
+    return { data, offset: -lo, shape, strides };
+  }
+
+  /**
+   * Copy the elements of the SubArray into `target` in column-major order
+   * with a native gather, without allocating in Julia.
+   *
+   * @param target A `TypedArray` matching the element type, with room for
+   * at least `length` elements.
+   * @returns The number of elements written.
+   */
+  gatherInto(target: BunArray): number {
+    const typed = this.typedLayout();
+    if (typed === null) {
+      throw new TypeError(
+        "gatherInto requires a strided SubArray of a numeric bits type",
+      );
+    }
+    if (!(target instanceof typed.ctor)) {
+      throw new TypeError(
+        `Expected a ${typed.ctor.name} for element type ${this.elType.name}`,
+      );
+    }
+    const written = JuliaSubArray.gather(typed.layout, target);
+    if (written < 0) {
+      throw new RangeError(
+        `Target of length ${target.length} is too small for ${this.length} elements`,
+      );
+    }
+    return written;
+  }
+
+  private static gather(layout: StridedLayout, target: BunArray): number {
+    const desc = new BigInt64Array(3 + 2 * STRIDED_MAX_DIMS);
+    desc[0] = BigInt(layout.ptr);
+    desc[1] = BigInt(layout.elsize);
+    desc[2] = BigInt(layout.shape.length);
+    layout.shape.forEach((d, k) => {
+      desc[3 + k] = BigInt(d);
+      desc[3 + STRIDED_MAX_DIMS + k] = BigInt(layout.strides[k]);
+    });
+    return Number(
+      jlbun.symbols.jlbun_strided_gather(desc, target, target.length),
+    );
+  }
+
   /**
    * Check if the SubArray's memory layout is contiguous.
    *
    * Contiguous SubArrays can be more efficiently converted to TypedArrays.
    */
   get isContiguous(): boolean {
+    const layout = this.layout;
+    if (layout !== null) {
+      return layout.contiguous;
+    }
+
     // Julia's DenseArray includes contiguous SubArrays
     // We check via Base.iscontiguous if available, or infer from type
     try {
@@ -334,11 +526,20 @@ export class JuliaSubArray implements JuliaValue {
   /**
    * Get the SubArray data as a JavaScript array or TypedArray.
    *
-   * Note: For non-contiguous SubArrays, this collects the data first.
+   * Strided SubArrays of numeric types are copied into a new TypedArray
+   * with one native gather. Other SubArrays are collected in Julia first.
    */
   // eslint-disable-next-line @typescript-eslint/no-explicit-any
   get value(): BunArray | any[] {
-    // SubArray may not have contiguous memory, so we collect it first
+    const typed = this.typedLayout();
+    if (typed !== null) {
+      const length = typed.layout.shape.reduce((a, b) => a * b, 1);
+      const out = new typed.ctor(length);
+      JuliaSubArray.gather(typed.layout, out);
+      return out;
+    }
+
+    // SubArray may not have strided memory, so we collect it first
     const collected = Julia.Base.collect(this);
     return collected.value;
   }
@@ -410,6 +611,10 @@ export class JuliaSubArray implements JuliaValue {
    * invalid if the parent array is garbage collected.
    */
   get rawPtr(): Pointer | null {
+    const layout = this.layout;
+    if (layout !== null) {
+      return layout.contiguous ? layout.ptr : null;
+    }
     if (!this.isContiguous) {
       return null;
     }
@@ -425,6 +630,15 @@ export class JuliaSubArray implements JuliaValue {
    */
   // eslint-disable-next-line @typescript-eslint/no-explicit-any
   get fastValue(): any[] | null {
+    const typed = this.typedLayout();
+    if (typed !== null) {
+      return typed.layout.contiguous
+        ? Array.from(
+            JuliaSubArray.viewOf(typed).data as ArrayLike<unknown>,
+          )
+        : null;
+    }
+
     const ptr = this.rawPtr;
     if (ptr === null) {
       return null;
@@ -0,0 +1,77 @@
+import { existsSync, readdirSync, readFileSync, statSync } from "fs";
+import { isAbsolute, join } from "path";
+
+/**
+ * Manifest written next to a sysimage by `julia/build.jl`.
+ */
+export interface SysimageManifest {
+  /** Julia version the sysimage was built with. */
+  julia: string;
+  /** Build time, in seconds since the epoch. */
+  created: number;
+  /** Directory the traces were collected from, if any. */
+  traceDir: string | null;
+  /** Traces whose statements were compiled into the sysimage. */
+  traces: { path: string; mtime: number; size: number }[];
+  /** Number of precompile statements compiled into the sysimage. */
+  statements: number;
+}
+
+/**
+ * Path of the manifest of a sysimage: the image path with a `.json`
+ * extension. Relative image paths are resolved against `bindir`, like
+ * `jl_init_with_image` does.
+ *
+ * @internal
+ */
+export function sysimageManifestPath(
+  bindir: string,
+  sysimage: string,
+): string {
+  const image = isAbsolute(sysimage) ? sysimage : join(bindir, sysimage);
+  return image.replace(/\.[^./\\]*$/, "") + ".json";
+}
+
+/**
+ * Check a sysimage against its manifest. Returns why the sysimage is stale,
+ * or `null` if it is up to date or was not built with a manifest.
+ *
+ * @internal
+ */
+export function checkSysimageManifest(
+  manifestPath: string,
+  juliaVersion: string,
+): string | null {
+  if (!existsSync(manifestPath)) {
+    return null;
+  }
+  const manifest = JSON.parse(
+    readFileSync(manifestPath, "utf8"),
+  ) as SysimageManifest;
+  if (manifest.julia !== juliaVersion) {
+    return `built with Julia ${manifest.julia}, running ${juliaVersion}`;
+  }
+  for (const trace of manifest.traces) {
+    if (!existsSync(trace.path)) {
+      continue;
+    }
+    const stat = statSync(trace.path);
+    if (
+      stat.size !== trace.size ||
+      Math.abs(stat.mtimeMs / 1000 - trace.mtime) > 1
+    ) {
+      return `trace ${trace.path} changed since the build`;
+    }
+  }
+  if (manifest.traceDir !== null && existsSync(manifest.traceDir)) {
+    const known = new Set(manifest.traces.map((trace) => trace.path));
+    const added = readdirSync(manifest.traceDir)
+      .filter((file) => file.endsWith(".jl"))
+      .map((file) => join(manifest.traceDir!, file))
+      .filter((path) => !known.has(path));
+    if (added.length > 0) {
+      return `new trace ${added[0]} since the build`;
+    }
+  }
+  return null;
+}
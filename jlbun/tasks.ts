@@ -1,5 +1,4 @@
 import { Pointer } from "bun:ffi";
-import { nextTick } from "process";
 import {
   jlbun,
   Julia,
@@ -8,6 +7,113 @@ import {
   JuliaValue,
   MethodError,
 } from "./index.js";
+import { JuliaScope, runWithJuliaScope } from "./scope.js";
+import { juliaHelper } from "./utils.js";
+
+// Interval of the completion poller, in milliseconds
+const TASK_POLL_INTERVAL = 1;
+
+// Schedule a task unless it has started or is already queued, e.g. by
+// `Threads.@spawn`; scheduling it twice would run it twice
+const SCHEDULE_FRESH = `t -> if istaskstarted(t) || t.queue !== nothing
+  false
+else
+  schedule(t)
+  true
+end`;
+
+interface PendingTask {
+  task: JuliaTask;
+  scope: JuliaScope;
+  resolve: (value: JuliaValue) => void;
+  reject: (reason: unknown) => void;
+}
+
+// Tasks awaited through `JuliaTask.value`, by completion ID
+const pendingTasks: Map<number, PendingTask> = new Map();
+const finishedIds = new BigUint64Array(64);
+let nextTaskId = 1;
+let pollTimer: ReturnType<typeof setInterval> | null = null;
+
+// Settle the promise of a finished task inside the scope that awaited it
+function settleTask(id: number): void {
+  const pending = pendingTasks.get(id);
+  if (pending === undefined) {
+    return;
+  }
+  pendingTasks.delete(id);
+  const { task, scope, resolve, reject } = pending;
+  if (scope.isDisposed) {
+    reject(new Error("The JuliaScope awaiting this task was disposed"));
+    return;
+  }
+  runWithJuliaScope(scope, () => {
+    try {
+      const result = Julia.Core.getproperty(task, JuliaSymbol.from("result"));
+      if (Julia.Base.istaskfailed(task).value) {
+        reject(result);
+      } else {
+        resolve(result);
+      }
+    } catch (err) {
+      reject(err);
+    }
+  });
+}
+
+// Drain finished tasks; runs on a timer while any task is awaited
+function pollTasks(): void {
+  // Only the first poll of a tick yields to Julia's scheduler
+  let yieldToJulia = 1;
+  for (;;) {
+    const n = Number(
+      jlbun.symbols.jlbun_task_poll(
+        finishedIds,
+        finishedIds.length,
+        yieldToJulia,
+      ),
+    );
+    yieldToJulia = 0;
+    if (n < 0) {
+      // Notifications were dropped: check every pending task
+      for (const [id, { task, scope }] of pendingTasks) {
+        if (
+          scope.isDisposed ||
+          runWithJuliaScope(scope, () => Julia.Base.istaskdone(task).value)
+        ) {
+          settleTask(id);
+        }
+      }
+      break;
+    }
+    for (let i = 0; i < n; i++) {
+      settleTask(Number(finishedIds[i]));
+    }
+    if (n < finishedIds.length) {
+      break;
+    }
+  }
+  if (pendingTasks.size === 0 && pollTimer !== null) {
+    clearInterval(pollTimer);
+    pollTimer = null;
+  }
+}
+
+/**
+ * Stop the completion poller and reject every pending `JuliaTask.value`.
+ *
+ * @internal
+ */
+export function closeTaskPoller(): void {
+  if (pollTimer !== null) {
+    clearInterval(pollTimer);
+    pollTimer = null;
+  }
+  for (const { reject } of pendingTasks.values()) {
+    reject(new Error("Julia was closed before the task finished"));
+  }
+  pendingTasks.clear();
+}
 
 /**
  * Wrapper for Julia `Task`s.
@@ -70,28 +176,37 @@ export class JuliaTask implements JuliaValue {
 
   /**
    * Schedule a `JuliaTask` and get a `Promise` representing the result of the task.
+   *
+   * JS never blocks waiting for the task. A Julia watcher task reports its
+   * completion to a native queue, which is drained on a timer while any task
+   * is awaited; each tick also runs Julia's event loop and yields to tasks
+   * queued on the main thread, so Julia I/O and timers keep making progress.
+   * Tasks on other threads (see `schedule()`) run without blocking Bun;
+   * tasks on the main thread run cooperatively, between JS events.
+   *
+   * The result is rooted in the scope that was active when `value` was read.
    */
   get value(): Promise<JuliaValue> {
     return new Promise((resolve, reject) => {
-      if (!Julia.Base.istaskstarted(this).value && !this.scheduled) {
-        Julia.Base.schedule(this);
+      const scope = Julia.requireActiveScope("JuliaTask.value");
+      if (!this.scheduled) {
+        Julia.call(juliaHelper("schedule_fresh", SCHEDULE_FRESH), this);
         this.scheduled = true;
       }
 
-      nextTick(() => {
-        Julia.Base.wait(this);
-        if (Julia.Base.istaskdone(this).value) {
-          const result = Julia.Core.getproperty(
-            this,
-            JuliaSymbol.from("result"),
-          );
-          if (Julia.Base.istaskfailed(this).value) {
-            reject(result);
-          } else {
-            resolve(result);
-          }
-        }
-      });
+      const id = nextTaskId++;
+      pendingTasks.set(id, { task: this, scope, resolve, reject });
+      if (Julia.Base.istaskdone(this).value) {
+        settleTask(id);
+        return;
+      }
+
+      if (jlbun.symbols.jlbun_task_watch(this.ptr, id) === null) {
+        pendingTasks.delete(id);
+        reject(new Error("Failed to watch Julia task for completion"));
+        return;
+      }
+      pollTimer ??= setInterval(pollTasks, TASK_POLL_INTERVAL);
     });
   }
 
@@ -1,5 +1,12 @@
 import { beforeAll, describe, expect, it } from "bun:test";
-import { Julia, JuliaArray, MethodError, UnknownJuliaError } from "../index.js";
+import {
+  Julia,
+  JuliaArray,
+  MethodError,
+  packStrings,
+  UnknownJuliaError,
+  unpackStrings,
+} from "../index.js";
 import {
   canResizeSharedBuffers,
   ensureJuliaInitialized,
@@ -291,4 +298,386 @@ describe("JuliaArray multi-dimensional", () => {
     const fromArray = Array.from(arr, (v) => v.value);
     expect(fromArray).toEqual([10, 20, 30, 40, 50]);
   });
+
+  it("iterates arrays spanning several wrapping chunks", () => {
+    const data = Float64Array.from({ length: 300 }, (_, i) => i / 2);
+    const arr = JuliaArray.from(data);
+    expect(Array.from(arr, (v) => v.value)).toEqual(Array.from(data));
+
+    const strings = Julia.eval("[string(i) for i in 1:200]") as JuliaArray;
+    const values = [...strings].map((v) => v.value);
+    expect(values.length).toBe(200);
+    expect(values[0]).toBe("1");
+    expect(values[199]).toBe("200");
+  });
+
+  it("fromAny boxes primitive values in one call", () => {
+    const arr = JuliaArray.fromAny([1, 2.5, true, 3n, -7]);
+    expect(arr.length).toBe(5);
+    expect(arr.elType.isEqual(Julia.Any)).toBe(true);
+    expect(arr.value).toEqual([1n, 2.5, true, 3n, -7n]);
+    expect(Julia.getTypeStr(arr.get(0))).toBe("Int64");
+    expect(Julia.getTypeStr(arr.get(1))).toBe("Float64");
+    expect(Julia.getTypeStr(arr.get(2))).toBe("Bool");
+
+    // Mixed values still go through the generic path
+    const mixed = JuliaArray.fromAny([1, "two", 2 ** 60]);
+    expect(mixed.value).toEqual([1n, "two", 2n ** 60n]);
+  });
+
+  it("fromAny infers concrete element types", () => {
+    const ints = JuliaArray.fromAny([1, -2, 2 ** 60, 3n]);
+    expect(ints.elType.isEqual(Julia.Int64)).toBe(true);
+    expect(ints.value).toEqual([1n, -2n, 2n ** 60n, 3n]);
+
+    const floats = JuliaArray.fromAny([1, 2.5, -0.25]);
+    expect(floats.elType.isEqual(Julia.Float64)).toBe(true);
+    expect(floats.value).toEqual([1, 2.5, -0.25]);
+
+    const bools = JuliaArray.fromAny([true, false, true]);
+    expect(bools.elType.isEqual(Julia.Bool)).toBe(true);
+    expect(bools.value).toEqual([true, false, true]);
+
+    const strings = JuliaArray.fromAny(["a", "", "héllo", "日本"]);
+    expect(strings.elType.isEqual(Julia.String)).toBe(true);
+    expect(strings.value).toEqual(["a", "", "héllo", "日本"]);
+  });
+
+  it("fromAny maps null and undefined to nothing", () => {
+    const ints = JuliaArray.fromAny([1, null, 3]);
+    expect(Julia.string(ints.elType)).toBe("Union{Nothing, Int64}");
+    expect(ints.get(0).value).toBe(1n);
+    expect(ints.get(1).value).toBe(null);
+    expect(ints.get(2).value).toBe(3n);
+
+    const strings = JuliaArray.fromAny([undefined, "b"]);
+    expect(Julia.string(strings.elType)).toBe("Union{Nothing, String}");
+    expect(strings.get(0).value).toBe(null);
+    expect(strings.get(1).value).toBe("b");
+
+    // Nothing to infer from, or no common concrete type
+    expect(JuliaArray.fromAny([null]).elType.isEqual(Julia.Any)).toBe(true);
+    expect(JuliaArray.fromAny([0.5, 1n]).elType.isEqual(Julia.Any)).toBe(true);
+  });
+
+  it("wraps N-D TypedArrays without copying", () => {
+    const data = Float64Array.from({ length: 24 }, (_, i) => i);
+    const tensor = JuliaArray.from(data, { shape: [2, 3, 4] });
+    expect(tensor.ndims).toBe(3);
+    expect(tensor.size).toEqual([2, 3, 4]);
+    // Column-major: (i, j, k) -> i + 2j + 6k
+    expect(tensor.getAt(1, 2, 3).value).toBe(23);
+
+    // Both sides see writes to the shared buffer
+    data[7] = -1;
+    expect(tensor.getAt(1, 0, 1).value).toBe(-1);
+    tensor.setAt(0, 1, 2, 100);
+    expect(data[14]).toBe(100);
+
+    // Honours the byte offset of subarray views
+    const tail = JuliaArray.from(data.subarray(12), { shape: [3, 4] });
+    expect(tail.getAt(2, 0).value).toBe(100);
+
+    expect(() => JuliaArray.from(data, { shape: [5, 5] })).toThrow(RangeError);
+    expect(() => JuliaArray.from(data, { shape: [4, -6] })).toThrow(
+      RangeError,
+    );
+  });
+
+  it("wraps row-major buffers as permuted views", () => {
+    // 2x3x4 in row-major order: (i, j, k) -> 12i + 4j + k
+    const data = Int32Array.from({ length: 24 }, (_, i) => i);
+    const view = JuliaArray.from(data, { shape: [2, 3, 4], rowMajor: true });
+    expect(Julia.Base.size(view).value).toEqual([2n, 3n, 4n]);
+    expect(Julia.Base.getindex(view, 2, 3, 4).value).toBe(23);
+    expect(Julia.Base.getindex(view, 2, 1, 3).value).toBe(14);
+
+    data[5] = -5;
+    expect(Julia.Base.getindex(view, 1, 2, 2).value).toBe(-5);
+    expect(Julia.Base.sum(view).value).toBe(
+      BigInt(data.reduce((a, b) => a + b, 0)),
+    );
+
+    // A 1-D row-major buffer is an ordinary vector
+    const vec = JuliaArray.from(data, { shape: [24], rowMajor: true });
+    expect(vec).toBeInstanceOf(JuliaArray);
+  });
+});
+
+describe("JuliaArray complex", () => {
+  it("shares interleaved buffers as complex vectors", () => {
+    const data = new Float64Array([1, 2, 3, -4]);
+    const arr = JuliaArray.fromComplex(data);
+    expect(Julia.string(arr)).toBe("ComplexF64[1.0 + 2.0im, 3.0 - 4.0im]");
+    expect(arr.length).toBe(2);
+    expect(Julia.Base.abs(arr.get(1)).value).toBe(5);
+
+    // Both sides see writes to the shared buffer
+    data[2] = 6;
+    expect(Julia.Base.real(arr.get(1)).value).toBe(6);
+    Julia.Base["setindex!"](arr, Julia.eval("0.5 + 0.25im"), 1);
+    expect(Array.from(data)).toEqual([0.5, 0.25, 6, -4]);
+
+    const f32 = JuliaArray.fromComplex(new Float32Array([1, 2]));
+    expect(Julia.getTypeStr(f32.get(0))).toBe("Complex");
+    expect(Julia.Base.imag(f32.get(0)).value).toBe(2);
+    expect(Julia.Base.eltype(f32).value).toBe("ComplexF32");
+    // 0x3c00 and 0x4000 are 1.0 and 2.0 in half precision
+    const f16 = JuliaArray.fromComplex(new Uint16Array([0x3c00, 0x4000]));
+    expect(Julia.Base.imag(f16.get(0)).value).toBe(2);
+    expect(Julia.Base.eltype(f16).value).toBe("ComplexF16");
+
+    const matrix = JuliaArray.fromComplex(new Float64Array(12), {
+      shape: [2, 3],
+    });
+    expect(matrix.size).toEqual([2, 3]);
+    expect(() => JuliaArray.fromComplex(new Float64Array(3))).toThrow(
+      RangeError,
+    );
+  });
+
+  it("views complex arrays as interleaved parts", () => {
+    const arr = Julia.eval("[1.0 + 2.0im, 3.0 + 4.0im]") as JuliaArray;
+    const parts = arr.value as Float64Array;
+    expect(parts).toBeInstanceOf(Float64Array);
+    expect(Array.from(parts)).toEqual([1, 2, 3, 4]);
+
+    // The view aliases the Julia memory
+    parts[3] = -4;
+    expect(Julia.Base.imag(arr.get(1)).value).toBe(-4);
+
+    const f32 = Julia.eval("ComplexF32[1 + 2im]") as JuliaArray;
+    expect(f32.value).toEqual(new Float32Array([1, 2]));
+  });
+});
+
+describe("JuliaArray Float16", () => {
+  it("widens Float16 arrays to Float32", () => {
+    // 20 elements cover both the vector lanes and the scalar tail
+    const arr = Julia.eval("Float16.(1:20) ./ 4") as JuliaArray;
+    expect(arr.toFloat32()).toEqual(
+      Float32Array.from({ length: 20 }, (_, i) => (i + 1) / 4),
+    );
+
+    const special = Julia.eval(
+      "Float16[-0.0, Inf, -Inf, NaN, nextfloat(Float16(0))]",
+    ) as JuliaArray;
+    const values = special.toFloat32();
+    expect(Object.is(values[0], -0)).toBe(true);
+    expect(values[1]).toBe(Infinity);
+    expect(values[2]).toBe(-Infinity);
+    expect(Number.isNaN(values[3])).toBe(true);
+    expect(values[4]).toBe(2 ** -24);
+
+    const complex = Julia.eval("ComplexF16[1 + 2im, 3 - 4im]") as JuliaArray;
+    expect(complex.toFloat32()).toEqual(new Float32Array([1, 2, 3, -4]));
+  });
+
+  it("narrows Float32 values rounding to nearest even", () => {
+    const values = [0.1, 1 + 2 ** -11, 1 + 3 * 2 ** -11, 65520, -1e-8, NaN];
+    const data = new Float32Array(values.flatMap((x) => [x, x]));
+    const arr = JuliaArray.fromFloat32AsFloat16(data);
+    expect(Julia.Base.eltype(arr).value).toBe("Float16");
+    // Same bits as Julia's own conversion
+    const expected = Julia.Base.broadcast(
+      Julia.Float16,
+      JuliaArray.from(data),
+    );
+    expect(Julia.Base.isequal(arr, expected).value).toBe(true);
+
+    const widened = arr.toFloat32();
+    expect(widened[2]).toBe(1);
+    expect(widened[4]).toBe(1 + 2 ** -9);
+    expect(widened[6]).toBe(Infinity);
+    expect(Object.is(widened[8], -0)).toBe(true);
+
+    const matrix = JuliaArray.fromFloat32AsFloat16(new Float32Array(6), 2, 3);
+    expect(matrix.size).toEqual([2, 3]);
+    expect(() =>
+      JuliaArray.fromFloat32AsFloat16(new Float32Array(5), 2, 3),
+    ).toThrow(RangeError);
+    // Dims whose product matches the length are still checked one by one
+    expect(() =>
+      JuliaArray.fromFloat32AsFloat16(new Float32Array(6), -2, -3),
+    ).toThrow(RangeError);
+    expect(() =>
+      JuliaArray.fromFloat32AsFloat16(new Float32Array(6), 1.5, 4),
+    ).toThrow(RangeError);
+  });
+
+  it("converts Float16 through bulk reads and writes", () => {
+    const arr = JuliaArray.init(Julia.Float16, 10);
+    const source = Float32Array.from({ length: 10 }, (_, i) => i - 4.5);
+    expect(arr.writeFrom(source)).toBe(10);
+    const out = new Float32Array(10);
+    expect(arr.readInto(out)).toBe(10);
+    expect(out).toEqual(source);
+  });
+
+  it("uses Float16Array where the runtime provides it", () => {
+    const F16 = (
+      globalThis as unknown as { Float16Array?: typeof Float32Array }
+    ).Float16Array;
+    if (F16 === undefined) {
+      return;
+    }
+    const arr = JuliaArray.from(new F16([1.5, -2]));
+    expect(Julia.Base.eltype(arr).value).toBe("Float16");
+    expect(arr.value).toBeInstanceOf(F16);
+    expect(Array.from(arr.value as Float32Array)).toEqual([1.5, -2]);
+  });
+});
+
+describe("JuliaArray bulk access", () => {
+  it("reads and writes dense arrays with one call", () => {
+    const arr = JuliaArray.from(new Float64Array([1, 2, 3, 4, 5, 6]));
+    const out = new Float64Array(6);
+    expect(arr.readInto(out)).toBe(6);
+    expect(out).toEqual(new Float64Array([1, 2, 3, 4, 5, 6]));
+
+    const part = new Float64Array(2);
+    expect(arr.readInto(part, { offset: 3 })).toBe(2);
+    expect(part).toEqual(new Float64Array([4, 5]));
+
+    expect(arr.writeFrom(new Float64Array([-1, -2]), { offset: 4 })).toBe(2);
+    expect(arr.value).toEqual(new Float64Array([1, 2, 3, 4, -1, -2]));
+
+    expect(() => arr.readInto(out, { offset: 2, count: 5 })).toThrow(
+      RangeError,
+    );
+    expect(() => arr.readInto(part, { count: 3 })).toThrow(RangeError);
+  });
+
+  it("converts between numeric element types", () => {
+    const arr = Julia.eval("Int32[1, -2, 300]") as JuliaArray;
+    const floats = new Float64Array(3);
+    arr.readInto(floats);
+    expect(floats).toEqual(new Float64Array([1, -2, 300]));
+
+    const bytes = new Uint8Array(3);
+    arr.readInto(bytes);
+    expect(bytes).toEqual(new Uint8Array([1, 254, 44]));
+
+    // Floats are never truncated to integers
+    const reals = Julia.eval("[1.5, 2.0]") as JuliaArray;
+    expect(() => reals.readInto(new Int32Array(2))).toThrow(TypeError);
+
+    // ...but clamped arrays clamp and round, as on assignment
+    const clamped = new Uint8ClampedArray(3);
+    arr.readInto(clamped);
+    expect(clamped).toEqual(new Uint8ClampedArray([1, 0, 255]));
+    const pixels = Julia.eval("[-0.5, 1.5, 2.5, 300.0]") as JuliaArray;
+    const out = new Uint8ClampedArray(4);
+    expect(pixels.readInto(out)).toBe(4);
+    expect(out).toEqual(new Uint8ClampedArray([0, 2, 2, 255]));
+  });
+
+  it("unboxes Vector{Any} with a validity bitmap", () => {
+    const arr = Julia.eval("Any[1, 2.5, missing, Int8(4), nothing, true]");
+    const values = new Float64Array(6);
+    const validity = new Uint8Array(1);
+    expect((arr as JuliaArray).readInto(values, { validity })).toBe(6);
+    expect(values).toEqual(new Float64Array([1, 2.5, 0, 4, 0, 1]));
+    expect(validity[0]).toBe(0b101011);
+
+    // Missing values need a bitmap
+    expect(() => (arr as JuliaArray).readInto(values)).toThrow(TypeError);
+
+    const strings = Julia.eval('Any[1, "two"]') as JuliaArray;
+    expect(() => strings.readInto(new Float64Array(2))).toThrow(TypeError);
+  });
+
+  it("reads and writes Union{Missing, T} arrays", () => {
+    const arr = Julia.eval("Union{Missing, Float64}[1.0, missing, 3.0]");
+    const values = new Float64Array(3);
+    const validity = new Uint8Array(1);
+    (arr as JuliaArray).readInto(values, { validity });
+    expect(values).toEqual(new Float64Array([1, 0, 3]));
+    expect(validity[0]).toBe(0b101);
+
+    (arr as JuliaArray).writeFrom(new Int32Array([7, 8, 9]), {
+      validity: new Uint8Array([0b110]),
+    });
+    (arr as JuliaArray).readInto(values, { validity });
+    expect(values).toEqual(new Float64Array([0, 8, 9]));
+    expect(validity[0]).toBe(0b110);
+  });
+
+  it("boxes values into Vector{Any}", () => {
+    const arr = Julia.eval("Vector{Any}(nothing, 3)") as JuliaArray;
+    arr.writeFrom(new BigInt64Array([1n, 2n, 3n]), {
+      validity: new Uint8Array([0b011]),
+    });
+    expect(arr.get(1).value).toBe(2n);
+    expect(Julia.getTypeStr(arr.get(0))).toBe("Int64");
+    expect(Julia.Base.ismissing(arr.get(2)).value).toBe(true);
+
+    // Element types restrict what can be stored
+    const ints = Julia.eval("Union{Int64, String}[1, 2]") as JuliaArray;
+    expect(() => ints.writeFrom(new Float64Array([1, 2]))).toThrow(TypeError);
+  });
+});
+
+describe("JuliaArray packed strings", () => {
+  it("builds Vector{String} from strings", () => {
+    const arr = JuliaArray.fromStrings(["a", "", "héllo", "日本語"]);
+    expect(arr.elType.isEqual(Julia.String)).toBe(true);
+    expect(arr.value).toEqual(["a", "", "héllo", "日本語"]);
+
+    const empty = JuliaArray.fromStrings([]);
+    expect(empty.length).toBe(0);
+    expect(empty.elType.isEqual(Julia.String)).toBe(true);
+
+    const blanks = JuliaArray.fromStrings(["", ""]);
+    expect(blanks.value).toEqual(["", ""]);
+  });
+
+  it("packs strings with Int32 or Int64 offsets", () => {
+    const packed = packStrings(["ab", null, "ü"]);
+    expect(packed.offsets).toEqual(new Int32Array([0, 2, 2, 4]));
+    expect(packed.validity).toEqual(new Uint8Array([0b101]));
+    expect(unpackStrings(packed)).toEqual(["ab", null, "ü"]);
+
+    const wide = packStrings(["ab", "c"], { offsets: "int64" });
+    expect(wide.offsets).toEqual(new BigInt64Array([0n, 2n, 3n]));
+    expect(wide.validity).toBeUndefined();
+
+    const arr = JuliaArray.fromStrings(packed);
+    expect(Julia.string(arr.elType)).toBe("Union{Nothing, String}");
+    expect(arr.get(0).value).toBe("ab");
+    expect(arr.get(1).value).toBe(null);
+    expect(JuliaArray.fromStrings(wide).value).toEqual(["ab", "c"]);
+  });
+
+  it("serializes Vector{String} in one call", () => {
+    const arr = Julia.eval('["x", "", "héllo", "日本"]') as JuliaArray;
+    const packed = arr.toStrings();
+    expect(packed.offsets).toEqual(new Int32Array([0, 1, 1, 7, 13]));
+    expect(packed.validity).toBeUndefined();
+    expect(new TextDecoder().decode(packed.bytes)).toBe("xhéllo日本");
+    expect(unpackStrings(packed)).toEqual(["x", "", "héllo", "日本"]);
+
+    const wide = arr.toStrings({ offsets: "int64" });
+    expect(wide.offsets).toEqual(new BigInt64Array([0n, 1n, 1n, 7n, 13n]));
+
+    // Larger than the initial size guess
+    const long = Julia.eval('[repeat("ab", 100) for _ in 1:3]') as JuliaArray;
+    expect(unpackStrings(long.toStrings())).toEqual(
+      Array(3).fill("ab".repeat(100)),
+    );
+  });
+
+  it("round-trips nothing and missing through the validity bitmap", () => {
+    const arr = Julia.eval('["a", nothing, missing, "b"]') as JuliaArray;
+    const packed = arr.toStrings();
+    expect(packed.validity).toEqual(new Uint8Array([0b1001]));
+    expect(unpackStrings(packed)).toEqual(["a", null, null, "b"]);
+
+    const copy = JuliaArray.fromStrings(packed);
+    expect(copy.get(3).value).toBe("b");
+    expect(copy.get(1).value).toBe(null);
+
+    const ints = Julia.eval('Any["a", 1]') as JuliaArray;
+    expect(() => ints.toStrings()).toThrow(TypeError);
+  });
 });
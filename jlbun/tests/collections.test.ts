@@ -1,5 +1,6 @@
 import { beforeAll, describe, expect, it } from "bun:test";
 import {
+  DimensionMismatch,
   Julia,
   JuliaDict,
   JuliaIdDict,
@@ -7,6 +8,9 @@ import {
   JuliaPair,
   JuliaSet,
   JuliaTuple,
+  type PackedStrings,
+  packStrings,
+  unpackStrings,
 } from "../index.js";
 import { ensureJuliaInitialized, useJuliaTestScope } from "./setup.js";
 
@@ -50,6 +54,14 @@ describe("JuliaTuple", () => {
     expect(tuple.value).toEqual([1n, 2n, "hello"]);
     expect(tuple.toString()).toBe('(1, 2, "hello")');
   });
+
+  it("converts mixed and empty tuples to JS", () => {
+    const mixed = Julia.eval(
+      '(1.5, true, "x", nothing, (2, 3))',
+    ) as JuliaTuple;
+    expect(mixed.value).toEqual([1.5, true, "x", null, [2n, 3n]]);
+    expect((Julia.eval("()") as JuliaTuple).value).toEqual([]);
+  });
 });
 
 describe("JuliaNamedTuple", () => {
@@ -152,6 +164,24 @@ describe("JuliaSet additional coverage", () => {
   });
 });
 
+describe("JuliaSet columns", () => {
+  it("builds and exports sets as columns", () => {
+    const set = JuliaSet.fromColumn(new Int32Array([3, 1, 3, 2]));
+    expect(Julia.string(set)).toContain("Set{Int32}");
+    expect(set.size).toBe(3);
+    const column = set.toColumn() as Int32Array;
+    expect(column).toBeInstanceOf(Int32Array);
+    expect(Array.from(column).sort()).toEqual([1, 2, 3]);
+
+    const words = JuliaSet.fromColumn(packStrings(["a", "b", "a"]));
+    expect(words.value).toEqual(new Set(["a", "b"]));
+    expect(unpackStrings(words.toColumn() as PackedStrings).sort()).toEqual([
+      "a",
+      "b",
+    ]);
+  });
+});
+
 describe("JuliaDict", () => {
   it("can be created from Julia", () => {
     const dict = Julia.eval(
@@ -278,6 +308,51 @@ describe("JuliaDict", () => {
   });
 });
 
+describe("JuliaDict columns", () => {
+  it("builds dicts from TypedArray and string columns", () => {
+    const dict = JuliaDict.fromColumns(
+      new BigInt64Array([1n, 2n, 3n]),
+      new Float64Array([0.5, 1.5, 2.5]),
+    );
+    expect(Julia.string(dict)).toContain("Dict{Int64, Float64}");
+    expect(dict.get(2n).value).toBe(1.5);
+    expect(dict.value).toEqual(
+      new Map([
+        [1n, 0.5],
+        [2n, 1.5],
+        [3n, 2.5],
+      ]),
+    );
+
+    const names = JuliaDict.fromColumns(packStrings(["a", "b"]), ["x", "y"]);
+    expect(Julia.string(names)).toContain("Dict{String, String}");
+    expect(names.get("b").value).toBe("y");
+
+    expect(() =>
+      JuliaDict.fromColumns(new Int32Array(2), new Int32Array(3)),
+    ).toThrow(DimensionMismatch);
+  });
+
+  it("exports keys and values as dense columns", () => {
+    const dict = Julia.eval(
+      'Dict("a" => 1.0, "bb" => 2.0, "ccc" => 3.0)',
+    ) as JuliaDict;
+    const { keys, values } = dict.toColumns();
+    expect(values).toBeInstanceOf(Float64Array);
+    const ks = unpackStrings(keys as PackedStrings);
+    const vs = Array.from(values as Float64Array);
+    // Columns line up in the dictionary's iteration order
+    expect(ks.map((k) => k!.length)).toEqual(vs);
+
+    const mixed = JuliaDict.from([["a", 1n]]).toColumns();
+    expect(mixed).toEqual({ keys: ["a"], values: [1n] });
+
+    const ids = JuliaIdDict.fromColumns(new Uint8Array([1, 2]), ["a", "b"]);
+    expect(Julia.string(ids)).toContain("IdDict{UInt8, String}");
+    expect(ids.size).toBe(2);
+  });
+});
+
 describe("JuliaIdDict", () => {
   it("can be created from JS", () => {
     const dict = JuliaIdDict.from([
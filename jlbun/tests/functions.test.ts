@@ -1,6 +1,13 @@
 import { CString, FFIType, Pointer, ptr, toArrayBuffer } from "bun:ffi";
 import { beforeAll, describe, expect, it } from "bun:test";
-import { Julia, JuliaArray, JuliaFunction, safeCString } from "../index.js";
+import {
+  DomainError,
+  Julia,
+  JuliaArray,
+  JuliaFunction,
+  JuliaNamedTuple,
+  safeCString,
+} from "../index.js";
 import { ensureJuliaInitialized, useJuliaTestScope } from "./setup.js";
 
 beforeAll(() => ensureJuliaInitialized());
@@ -49,6 +56,30 @@ describe("JuliaFunction", () => {
     expect(f3_3.callWithKwargs({ a: 1, b: 2, c: 3 }, 1, 2, 3).value).toBe(36n);
   });
 
+  it("reuses keyword shapes across calls", () => {
+    const show = Julia.eval(
+      "(x...; kws...) -> string(x, \" \", NamedTuple(kws))",
+    ) as JuliaFunction;
+    expect(show.callWithKwargs({ a: 1, b: "s" }, 1).value).toBe(
+      '(1,) (a = 1, b = "s")',
+    );
+    // Same key set with other value types, and in another order
+    expect(show.callWithKwargs({ a: 1.5, b: true }).value).toBe(
+      "() (a = 1.5, b = true)",
+    );
+    expect(show.callWithKwargs({ b: 2, a: 1 }, 1, 2, 3, 4).value).toBe(
+      "(1, 2, 3, 4) (b = 2, a = 1)",
+    );
+    expect(show.callWithKwargs({}, 1).value).toBe("(1,) NamedTuple()");
+    expect(
+      show.callWithKwargs(JuliaNamedTuple.from({ c: 3 }), 1).value,
+    ).toBe("(1,) (c = 3,)");
+
+    const f = Julia.eval("(; a) -> sqrt(a)") as JuliaFunction;
+    expect(() => f.callWithKwargs({ a: -1 })).toThrow(DomainError);
+    expect(() => f.callWithKwargs({ b: 1 })).toThrow();
+  });
+
   it("can be created from a JS function", () => {
     const jsFunc = (x: number, y: Pointer) => {
       const str = `${new CString(y).toString()} ${x}`;
@@ -121,6 +152,61 @@ describe("JuliaFunction", () => {
   });
 });
 
+describe("JuliaFunction callback trampolines", () => {
+  it("shares one trampoline type per signature", () => {
+    const add = JuliaFunction.from((x: number, y: number) => x + y, {
+      returns: "f64",
+      args: ["f64", "f64"],
+    });
+    const mul = JuliaFunction.from((x: number, y: number) => x * y, {
+      returns: "f64",
+      args: ["f64", "f64"],
+    });
+    const answer = JuliaFunction.from(() => 42, { returns: "i32", args: [] });
+
+    expect(add(2, 3).value).toBe(5);
+    expect(mul(2, 3).value).toBe(6);
+    expect(answer().value).toBe(42);
+    expect(Julia.typeof(add).isEqual(Julia.typeof(mul))).toBe(true);
+    expect(Julia.typeof(add).isEqual(Julia.typeof(answer))).toBe(false);
+    add.close();
+    mul.close();
+    answer.close();
+  });
+
+  it("maps whole arrays with one call into JS", () => {
+    let calls = 0;
+    const double = JuliaFunction.fromVectorized(
+      (input: Int32Array, output: Float64Array) => {
+        calls++;
+        for (let i = 0; i < input.length; i++) {
+          output[i] = 2 * input[i];
+        }
+      },
+      { arg: "i32", returns: "f64" },
+    );
+
+    const xs = JuliaArray.from(new Int32Array([1, 2, 3, 4]));
+    expect(double(xs).value).toEqual(new Float64Array([2, 4, 6, 8]));
+    expect(calls).toBe(1);
+
+    // Non-dense inputs are converted first; empty inputs skip the call
+    const range = Julia.eval("Int32(1):Int32(3)");
+    expect(double(range).value).toEqual(new Float64Array([2, 4, 6]));
+    const empty = JuliaArray.from(new Int32Array(0));
+    expect(double(empty).value).toEqual(new Float64Array(0));
+    expect(calls).toBe(2);
+
+    expect(() =>
+      JuliaFunction.fromVectorized(() => {}, {
+        arg: "cstring",
+        returns: "f64",
+      }),
+    ).toThrow(TypeError);
+    double.close();
+  });
+});
+
 describe("JuliaFunction FinalizationRegistry coverage", () => {
   it("cleans up JSCallback when JuliaFunction is garbage collected", async () => {
     // Create a function that will be garbage collected
@@ -144,3 +230,113 @@ describe("JuliaFunction FinalizationRegistry coverage", () => {
     Bun.gc(true);
   });
 });
+
+describe("Julia.batch", () => {
+  it("runs recorded calls and returns every result", () => {
+    Julia.scope((julia) => {
+      const results = julia.batch((b) => {
+        const xs = b.call(julia.Base.collect, Julia.Base.UnitRange(1, 4));
+        const squares = b.call(julia.Base.map, julia.Base.abs2, xs);
+        b.call(julia.Base.sum, squares);
+      });
+
+      expect(results.length).toBe(3);
+      expect(results[1].value).toEqual(new BigInt64Array([1n, 4n, 9n, 16n]));
+      expect(results[2].value).toBe(30n);
+    });
+  });
+
+  it("accepts slots as callees and auto-wraps JS arguments", () => {
+    Julia.scope((julia) => {
+      const [, result] = julia.batch((b) => {
+        const f = b.call(julia.Base.identity, julia.eval("(x, y) -> x * y"));
+        b.call(f, 6, 7);
+      });
+      expect(result.value).toBe(42n);
+    });
+  });
+
+  it("reports the first failing call and skips the rest", () => {
+    Julia.scope((julia) => {
+      const counter = julia.eval("Ref(0)");
+      const bump = julia.eval("r -> (r[] += 1)");
+      let recorded = 0;
+      expect(() =>
+        julia.batch((b) => {
+          b.call(bump, counter);
+          b.call(julia.Base.sqrt, -1.0);
+          b.call(bump, counter);
+          b.call(bump, counter);
+          recorded = b.length;
+        }),
+      ).toThrow(DomainError);
+      expect(recorded).toBe(4);
+      // Only the call before the failing one ran
+      expect(julia.Base.getindex(counter).value).toBe(1n);
+
+      expect(() =>
+        julia.batch((b) => {
+          b.call(julia.Base.sqrt, 4.0);
+          b.call(julia.Base.sqrt, -1.0);
+        }),
+      ).toThrow("Batch call 1:");
+    });
+  });
+
+  it("rejects slots from another batch", () => {
+    Julia.scope((julia) => {
+      let foreign: unknown;
+      julia.batch((b) => {
+        foreign = b.call(julia.Base.identity, 1);
+      });
+      expect(() =>
+        julia.batch((b) => {
+          b.call(julia.Base.identity, foreign);
+        }),
+      ).toThrow("JuliaBatchSlot belongs to a different JuliaBatch");
+    });
+  });
+});
+
+describe("JuliaFunction.compile", () => {
+  it("compiles a function into a native entry point", () => {
+    Julia.scope((julia) => {
+      const sin = julia.Base.sin.compile("(f64) -> f64");
+      expect(sin(0.5)).toBeCloseTo(Math.sin(0.5));
+      expect(sin.signature).toBe("(f64)->f64");
+      expect(sin.ptr).not.toBe(0);
+    });
+  });
+
+  it("caches entry points per function and signature", () => {
+    Julia.scope((julia) => {
+      const a = julia.Base.cos.compile("(f64) -> f64");
+      const b = julia.Base.cos.compile(" ( f64 )->f64 ");
+      const c = julia.Base.cos.compile("(f32) -> f32");
+      expect(a).toBe(b);
+      expect(c).not.toBe(a);
+      expect(c(0)).toBe(1);
+    });
+  });
+
+  it("accepts pointer arguments", () => {
+    Julia.scope((julia) => {
+      const kernel = julia.eval(
+        "(p::Ptr{Nothing}, n::Int64) -> sum(unsafe_wrap(Array, Ptr{Float64}(p), n))",
+      ) as JuliaFunction;
+      const sum = kernel.compile("(ptr, i64) -> f64");
+      const data = new Float64Array([1.5, 2.5, 3]);
+      expect(sum(ptr(data), data.length)).toBe(7);
+    });
+  });
+
+  it("rejects malformed signatures", () => {
+    Julia.scope((julia) => {
+      expect(() => julia.Base.sin.compile("f64 -> f64")).toThrow(SyntaxError);
+      expect(() => julia.Base.sin.compile("(string) -> f64")).toThrow(
+        TypeError,
+      );
+      expect(() => julia.Base.sin.compile("(void) -> f64")).toThrow(TypeError);
+    });
+  });
+});
@@ -33,6 +33,91 @@ describe("Julia", () => {
     });
   });
 
+  it("compiles tag templates once and passes values as arguments", () => {
+    const internals = Julia as unknown as {
+      compiledTemplates: WeakMap<TemplateStringsArray, JuliaFunction | null>;
+    };
+    const templates: TemplateStringsArray[] = [];
+    const tag = (strings: TemplateStringsArray, ...values: unknown[]) => {
+      templates.push(strings);
+      return Julia.tagEval(strings, ...values);
+    };
+    const increment = (x: number) => tag`let y = ${x}; y + 1 end`;
+    expect(increment(1).value).toBe(2n);
+    expect(increment(41).value).toBe(42n);
+    expect(templates[0]).toBe(templates[1]);
+    expect(internals.compiledTemplates.get(templates[0])).toBeInstanceOf(
+      JuliaFunction,
+    );
+
+    // Assignments to globals keep running at top level
+    const assign = (x: number) => tag`__jlbun_tagged_global__ = ${x}`;
+    assign(3);
+    assign(4);
+    expect(Julia.eval("__jlbun_tagged_global__").value).toBe(4n);
+    expect(internals.compiledTemplates.get(templates[2])).toBeNull();
+  });
+
+  it("caches eval thunks in an LRU", () => {
+    const internals = Julia as unknown as {
+      evalCache: Map<string, JuliaFunction | null>;
+    };
+    const capacity = Julia.evalCacheCapacity;
+    internals.evalCache.clear();
+    try {
+      Julia.evalCacheCapacity = 2;
+      expect(Julia.eval("sum(1:10)", { cache: true }).value).toBe(55n);
+      expect(Julia.eval("2 + 2", { cache: true }).value).toBe(4n);
+      expect(Julia.eval("sum(1:10)", { cache: true }).value).toBe(55n);
+      expect(Julia.eval("3 + 3", { cache: true }).value).toBe(6n);
+      expect([...internals.evalCache.keys()]).toEqual(["sum(1:10)", "3 + 3"]);
+      expect(internals.evalCache.get("3 + 3")).toBeInstanceOf(JuliaFunction);
+
+      Julia.eval("const __jlbun_cached_const__ = 1", { cache: true });
+      expect(
+        internals.evalCache.get("const __jlbun_cached_const__ = 1"),
+      ).toBeNull();
+      expect(Julia.eval("__jlbun_cached_const__").value).toBe(1n);
+    } finally {
+      Julia.evalCacheCapacity = capacity;
+      internals.evalCache.clear();
+    }
+  });
+
+  it("keeps evicted eval thunks working past the cache capacity", () => {
+    const internals = Julia as unknown as {
+      evalCache: Map<string, JuliaFunction | null>;
+    };
+    const capacity = Julia.evalCacheCapacity;
+    internals.evalCache.clear();
+    try {
+      Julia.evalCacheCapacity = 2;
+      expect(Julia.eval("1 + 10", { cache: true }).value).toBe(11n);
+      const first = internals.evalCache.get("1 + 10")!;
+      for (let i = 2; i <= 5; i++) {
+        expect(Julia.eval(`${i} + 10`, { cache: true }).value).toBe(
+          BigInt(i + 10),
+        );
+      }
+      expect([...internals.evalCache.keys()]).toEqual(["4 + 10", "5 + 10"]);
+
+      // Eviction only drops the lookup: the thunk is still alive in Julia
+      for (let i = 0; i < 3; i++) {
+        Julia.unsafe.eval("GC.gc()");
+        Bun.gc(true);
+      }
+      expect(first().value).toBe(11n);
+
+      // An evicted source is compiled again into a new thunk
+      expect(Julia.eval("1 + 10", { cache: true }).value).toBe(11n);
+      expect(internals.evalCache.get("1 + 10")).not.toBe(first);
+      expect(internals.evalCache.size).toBe(2);
+    } finally {
+      Julia.evalCacheCapacity = capacity;
+      internals.evalCache.clear();
+    }
+  });
+
   it("exposes the Julia version", () => {
     const runtimeVersion = (Julia.eval("string(VERSION)") as JuliaString).value;
     expect(Julia.version).toBe(runtimeVersion);
@@ -11,6 +11,7 @@ import {
   JuliaNothing,
   JuliaScope,
   JuliaString,
+  JuliaTask,
   JuliaValue,
   ScopeOwnershipError,
   ScopeRequiredError,
@@ -34,6 +35,32 @@ describe("v0.3 scope-first lifecycle", () => {
     expect(() => JuliaString.from("x")).toThrowError(ScopeRequiredError);
   });
 
+  it("rejects Julia.rpc.call without an active scope", async () => {
+    const abs2 = Julia.scope(() => Julia.Base.abs2);
+    Julia.rpc.start({ workers: 1 });
+    try {
+      await expect(Julia.rpc.call(abs2)).rejects.toThrowError(
+        ScopeRequiredError,
+      );
+      await expect(Julia.rpc.call(abs2, 2)).rejects.toThrowError(
+        ScopeRequiredError,
+      );
+    } finally {
+      await Julia.rpc.stop();
+    }
+  });
+
+  it("rejects JuliaTask.value without an active scope", async () => {
+    const task = Julia.scope((julia) => julia.eval("Task(() -> 1)"));
+    await expect((task as JuliaTask).value).rejects.toThrowError(
+      ScopeRequiredError,
+    );
+    // Nothing was left pending: the task can still be awaited in a scope
+    await Julia.scopeAsync(async () => {
+      expect((await (task as JuliaTask).value).value).toBe(1n);
+    });
+  });
+
   it("allows the same operations through Julia.scope", () => {
     const result = Julia.scope((julia) => {
       const arr = julia.eval("[1, 2, 3]");
@@ -8,7 +8,10 @@ import {
   JuliaScope,
   JuliaSubArray,
   JuliaTask,
+  ScopeOwnershipError,
+  type ScopeSummary,
 } from "../index.js";
+import { getJuliaOwnership } from "../ownership.js";
 import { ensureJuliaInitialized } from "./setup.js";
 
 beforeAll(() => ensureJuliaInitialized());
@@ -384,6 +387,25 @@ describe("JuliaScope internal methods", () => {
     // Escaped array should still be usable
     expect(arr.length).toBe(5);
   });
+
+  it("escape rejects disposed scopes and slots it no longer owns", () => {
+    const stale = new JuliaScope();
+    const dropped = stale.run(() => JuliaArray.init(Julia.Int64, 2));
+    stale.dispose();
+    expect(() => stale.escape(dropped)).toThrow("disposed scope");
+
+    const scope = new JuliaScope();
+    const arr = scope.run(() => JuliaArray.init(Julia.Int64, 2));
+    const other = GCManager.scopeBegin();
+    try {
+      // Simulate the slot being released and reused by another scope
+      GCManager.transfer(getJuliaOwnership(arr)!.idx!, other);
+      expect(() => scope.escape(arr)).toThrow(ScopeOwnershipError);
+    } finally {
+      scope.dispose();
+      GCManager.scopeEnd(other);
+    }
+  });
 });
 
 describe("GCManager API coverage", () => {
@@ -420,7 +442,7 @@ describe("GCManager API coverage", () => {
 
     const scope1 = GCManager.scopeBegin();
     const arr1 = Julia.unsafe.eval("zeros(Float64, 3)") as JuliaArray;
-    GCManager.pushScoped(arr1, scope1);
+    const idx1 = GCManager.pushScoped(arr1, scope1);
 
     const scope2 = GCManager.scopeBegin();
     const arr2 = Julia.unsafe.eval("zeros(Int64, 5)") as JuliaArray;
@@ -432,12 +454,219 @@ describe("GCManager API coverage", () => {
     GCManager.scopeEnd(scope2);
 
     // scope1's value should still be protected
-    expect(GCManager.get(sizeBefore)).toBe(arr1.ptr);
+    expect(GCManager.get(idx1)).toBe(arr1.ptr);
+    expect(GCManager.size).toBe(sizeBefore + 1);
 
     // Release scope1
     GCManager.scopeEnd(scope1);
   });
 
+  it("reuses slots released by earlier scopes", () => {
+    const scope1 = GCManager.scopeBegin();
+    const kept = Julia.unsafe.eval("zeros(Float64, 2)") as JuliaArray;
+    const temp = Julia.unsafe.eval("zeros(Float64, 3)") as JuliaArray;
+    const keptIdx = GCManager.pushScoped(kept, scope1);
+    const tempIdx = GCManager.pushScoped(temp, scope1);
+
+    // Escape one value, leaving a hole once the scope ends
+    GCManager.transfer(keptIdx, 0n);
+    GCManager.scopeEnd(scope1);
+    expect(GCManager.get(tempIdx)).not.toBe(temp.ptr);
+    expect(GCManager.get(keptIdx)).toBe(kept.ptr);
+
+    // Slots are reused within a shard, so pick a scope of the same shard
+    const capacityBefore = GCManager.capacity;
+    let scope2 = GCManager.scopeBegin();
+    while (GCManager.shardOf(scope2) !== GCManager.shardOf(scope1)) {
+      scope2 = GCManager.scopeBegin();
+    }
+    const next = Julia.unsafe.eval("zeros(Int64, 4)") as JuliaArray;
+    const nextIdx = GCManager.pushScoped(next, scope2);
+    expect(nextIdx).toBe(tempIdx);
+    expect(GCManager.capacity).toBe(capacityBefore);
+    GCManager.scopeEnd(scope2);
+
+    GCManager.release(keptIdx);
+    expect(GCManager.getScope(keptIdx)).toBe(0n);
+  });
+
+  it("release ignores slots that are already free", () => {
+    const scopeId = GCManager.scopeBegin();
+    const arr = Julia.unsafe.eval("zeros(Float64, 3)") as JuliaArray;
+    const idx = GCManager.pushScoped(arr, scopeId);
+    const sizeBefore = GCManager.size;
+
+    GCManager.release(idx);
+    expect(GCManager.size).toBe(sizeBefore - 1);
+    GCManager.release(idx);
+    expect(GCManager.size).toBe(sizeBefore - 1);
+    GCManager.scopeEnd(scopeId);
+    expect(GCManager.size).toBe(sizeBefore - 1);
+  });
+
+  it("pushScopedMany roots a batch and releaseMany frees it", () => {
+    const scopeId = GCManager.scopeBegin();
+    const a = Julia.unsafe.eval("zeros(Float64, 3)") as JuliaArray;
+    const b = Julia.unsafe.eval("ones(Float64, 3)") as JuliaArray;
+    const count = GCManager.segmentSize + 10; // needs to grow the shard
+    const ptrs = BigUint64Array.from({ length: count }, (_, i) =>
+      BigInt(i % 2 === 0 ? a.ptr : b.ptr),
+    );
+    const sizeBefore = GCManager.size;
+
+    const idxs = GCManager.pushScopedMany(ptrs, scopeId)!;
+    expect(idxs.length).toBe(count);
+    expect(new Set(idxs).size).toBe(count);
+    expect(GCManager.size).toBe(sizeBefore + count);
+    for (const idx of idxs) {
+      expect(idx % GCManager.shardCount).toBe(GCManager.shardOf(scopeId));
+      expect(GCManager.getScope(idx)).toBe(scopeId);
+    }
+    expect(GCManager.get(idxs[0])).toBe(a.ptr);
+    expect(GCManager.get(idxs[1])).toBe(b.ptr);
+
+    GCManager.releaseMany(idxs.slice(0, 10));
+    expect(GCManager.size).toBe(sizeBefore + count - 10);
+    GCManager.releaseMany(idxs.slice(0, 10)); // already free
+    expect(GCManager.size).toBe(sizeBefore + count - 10);
+    GCManager.scopeEnd(scopeId);
+    expect(GCManager.size).toBe(sizeBefore);
+  });
+
+  it("call roots many primitive arguments in bulk", () => {
+    const result = Julia.scope((julia) => {
+      const tuple = Julia.getFunction(Julia.Core, "tuple");
+      const sizeBefore = GCManager.size;
+      const t = julia.call(tuple, 1, 2.5, 3, 4n, -5, 6.25)!;
+      // The tuple and its six boxed arguments
+      expect(GCManager.size).toBe(sizeBefore + 7);
+      return t.value;
+    });
+    expect(result).toEqual([1n, 2.5, 3n, 4n, -5n, 6.25]);
+  });
+
+  it("stats reports rooting activity in one read", () => {
+    const before = GCManager.stats();
+    const scopeId = GCManager.scopeBegin();
+    const arr = Julia.unsafe.eval("zeros(Float64, 3)") as JuliaArray;
+    const idxs = [0, 1, 2].map(() => GCManager.pushScoped(arr, scopeId));
+    const escaped = GCManager.transfer(idxs[0], 0n);
+    expect(GCManager.scopeEnd(scopeId)).toBe(2);
+    const after = GCManager.stats();
+
+    expect(after.pushes - before.pushes).toBe(3);
+    expect(after.transfers - before.transfers).toBe(1);
+    expect(after.escapes - before.escapes).toBe(1);
+    expect(after.scopeEnds - before.scopeEnds).toBe(1);
+    expect(after.slotsScanned - before.slotsScanned).toBe(2);
+    expect(after.releases - before.releases).toBe(2);
+    expect(after.live).toBe(GCManager.size);
+    expect(after.capacity).toBe(GCManager.capacity);
+    expect(after.highWater).toBeGreaterThanOrEqual(after.live);
+    expect(after.fragmentation).toBeLessThanOrEqual(
+      after.capacity - after.live,
+    );
+    expect(after.lockAcquisitions).toBeGreaterThan(before.lockAcquisitions);
+
+    GCManager.release(escaped);
+    expect(GCManager.stats().releases - after.releases).toBe(1);
+  });
+
+  it("onScopeSummary reports each disposed scope", () => {
+    const summaries: ScopeSummary[] = [];
+    GCManager.onScopeSummary = (summary) => summaries.push(summary);
+    try {
+      Julia.scope((julia) => {
+        const a = julia.Array.init(julia.Float64, 10);
+        julia.Array.init(julia.Float64, 10);
+        julia.escape(a);
+      });
+    } finally {
+      GCManager.onScopeSummary = null;
+    }
+
+    expect(summaries.length).toBe(1);
+    const [summary] = summaries;
+    expect(summary.mode).toBe("default");
+    expect(summary.scopeId).toBeGreaterThan(0n);
+    expect(summary.tracked).toBe(2);
+    expect(summary.escaped).toBe(1);
+    expect(summary.released).toBe(1);
+    expect(summary.durationMs).toBeGreaterThanOrEqual(summary.releaseMs);
+
+    // Scopes are no longer reported once the listener is removed
+    Julia.scope((julia) => julia.Array.init(julia.Float64, 1));
+    expect(summaries.length).toBe(1);
+  });
+
+  it("grows by whole segments and trims them once empty", () => {
+    const segment = GCManager.segmentSize;
+    const capacityBefore = GCManager.capacity;
+    const scopeId = GCManager.scopeBegin();
+    const arr = Julia.unsafe.eval("zeros(Float64, 1)") as JuliaArray;
+    for (let i = 0; i < segment * 4; i++) {
+      GCManager.pushScoped(arr, scopeId);
+    }
+
+    const grown = GCManager.capacity;
+    expect(grown).toBeGreaterThan(capacityBefore);
+    expect(grown % segment).toBe(0);
+
+    GCManager.scopeEnd(scopeId);
+    expect(GCManager.trim()).toBeGreaterThan(0);
+    expect(GCManager.capacity).toBeLessThan(grown);
+    expect(GCManager.capacity).toBeLessThanOrEqual(capacityBefore + segment);
+  });
+
+  it("releases idle segments at scope end", () => {
+    const threshold = GCManager.idleThresholdMs;
+    GCManager.idleThresholdMs = 0;
+    try {
+      const segment = GCManager.segmentSize;
+      const capacityBefore = GCManager.capacity;
+      const scopeId = GCManager.scopeBegin();
+      const arr = Julia.unsafe.eval("zeros(Float64, 1)") as JuliaArray;
+      for (let i = 0; i < segment * 4; i++) {
+        GCManager.pushScoped(arr, scopeId);
+      }
+      GCManager.scopeEnd(scopeId);
+      expect(GCManager.capacity).toBeLessThanOrEqual(capacityBefore + segment);
+    } finally {
+      GCManager.idleThresholdMs = threshold;
+    }
+    expect(GCManager.idleThresholdMs).toBe(threshold);
+    expect(() => {
+      GCManager.idleThresholdMs = -1;
+    }).toThrow(RangeError);
+  });
+
+  it("releases idle segments when later scopes begin", () => {
+    const threshold = GCManager.idleThresholdMs;
+    GCManager.idleThresholdMs = 50;
+    try {
+      const segment = GCManager.segmentSize;
+      const capacityBefore = GCManager.capacity;
+      const scopeId = GCManager.scopeBegin();
+      const arr = Julia.unsafe.eval("zeros(Float64, 1)") as JuliaArray;
+      for (let i = 0; i < segment * 4; i++) {
+        GCManager.pushScoped(arr, scopeId);
+      }
+      GCManager.scopeEnd(scopeId);
+      // Not idle yet: the segments are kept
+      const grown = GCManager.capacity;
+      expect(grown).toBeGreaterThan(capacityBefore + segment);
+
+      // Nothing is released after the burst, only new scopes begin
+      Bun.sleepSync(60);
+      for (let i = 0; i < GCManager.shardCount; i++) {
+        GCManager.scopeEnd(GCManager.scopeBegin());
+      }
+      expect(GCManager.capacity).toBeLessThanOrEqual(capacityBefore + segment);
+    } finally {
+      GCManager.idleThresholdMs = threshold;
+    }
+  });
+
   it("get returns value at index", () => {
     const scopeId = GCManager.scopeBegin();
     const arr = Julia.unsafe.eval("zeros(Float64, 3)") as JuliaArray;
@@ -471,18 +700,43 @@ describe("GCManager API coverage", () => {
     // Initially in scope1
     expect(GCManager.getScope(idx)).toBe(scope1);
 
-    // Transfer to scope2
-    GCManager.transfer(idx, scope2);
-    expect(GCManager.getScope(idx)).toBe(scope2);
+    // Transfer to scope2 (the index changes if scope2 lives in another shard)
+    const moved = GCManager.transfer(idx, scope2);
+    expect(moved).toBeGreaterThanOrEqual(0);
+    expect(GCManager.getScope(moved)).toBe(scope2);
 
     // End scope1 - arr should still be valid (it's in scope2)
     GCManager.scopeEnd(scope1);
-    expect(GCManager.get(idx)).toBe(arr.ptr);
+    expect(GCManager.get(moved)).toBe(arr.ptr);
 
     // End scope2
     GCManager.scopeEnd(scope2);
   });
 
+  it("transfer across shards moves the value to a new slot", () => {
+    const scope1 = GCManager.scopeBegin();
+    let scope2 = GCManager.scopeBegin();
+    while (GCManager.shardOf(scope2) === GCManager.shardOf(scope1)) {
+      scope2 = GCManager.scopeBegin();
+    }
+
+    const arr = Julia.unsafe.eval("zeros(Float64, 3)") as JuliaArray;
+    const idx = GCManager.pushScoped(arr, scope1);
+    const sizeBefore = GCManager.size;
+    const moved = GCManager.transfer(idx, scope2);
+
+    expect(moved).not.toBe(idx);
+    expect(moved % GCManager.shardCount).toBe(GCManager.shardOf(scope2));
+    expect(GCManager.get(moved)).toBe(arr.ptr);
+    expect(GCManager.getScope(idx)).toBe(0n); // Old slot is free
+    expect(GCManager.size).toBe(sizeBefore);
+
+    GCManager.scopeEnd(scope1);
+    expect(GCManager.get(moved)).toBe(arr.ptr);
+    GCManager.scopeEnd(scope2);
+    expect(GCManager.size).toBe(sizeBefore - 1);
+  });
+
   it("transfer to global scope (0n) prevents auto-release", () => {
     const scopeId = GCManager.scopeBegin();
     const arr = Julia.unsafe.eval("zeros(Float64, 5)") as JuliaArray;
@@ -524,6 +778,28 @@ describe("GCManager API coverage", () => {
     GCManager.scopeEnd(scopeId);
   });
 
+  it("shardStats reports per-shard locks and occupancy", () => {
+    const stats = GCManager.shardStats();
+    expect(stats.length).toBe(GCManager.shardCount);
+    expect(stats.reduce((sum, s) => sum + s.capacity, 0)).toBe(
+      GCManager.capacity,
+    );
+
+    const scopeId = GCManager.scopeBegin();
+    const shard = GCManager.shardOf(scopeId);
+    const arr = Julia.unsafe.eval("zeros(Float64, 3)") as JuliaArray;
+    const before = GCManager.shardStats()[shard];
+    const idx = GCManager.pushScoped(arr, scopeId);
+    const after = GCManager.shardStats()[shard];
+
+    expect(idx % GCManager.shardCount).toBe(shard);
+    expect(after.acquisitions).toBeGreaterThan(before.acquisitions);
+    expect(after.contentions).toBeGreaterThanOrEqual(before.contentions);
+    expect(after.live).toBe(before.live + 1);
+    GCManager.scopeEnd(scopeId);
+    expect(GCManager.shardStats()[shard].live).toBe(before.live);
+  });
+
   // Perf mode GCManager API tests
   it("isPerfInitialized returns true after perf mode is used", () => {
     // Perf mode is auto-initialized on first use
@@ -738,6 +1014,23 @@ describe("Julia.scope safe mode", () => {
     expect(captured!.value[0]).toBe(100);
   });
 
+  it("safe mode dispose skips values whose transfer fails", () => {
+    const scope = new JuliaScope({ mode: "safe" });
+    const arr = scope.julia.Array.init(scope.julia.Float64, 3);
+    const tracked = scope.size;
+    // Free the slot behind the scope's back, so the transfer fails in C
+    GCManager.release(getJuliaOwnership(arr)!.idx!);
+    const before = GCManager.stats();
+    scope.dispose();
+    const after = GCManager.stats();
+
+    // No escape is recorded for the freed slot, only for the other values
+    expect(getJuliaOwnership(arr)?.kind).toBe("scoped");
+    expect(after.escapes - before.escapes).toBe(tracked - 1);
+    expect(scope.isDisposed).toBe(true);
+    expect(scope.size).toBe(0);
+  });
+
   it("default mode (fast) still works", () => {
     const result = Julia.scope((julia) => {
       const arr = julia.Array.init(julia.Float64, 5);
@@ -992,6 +1285,49 @@ describe("Perf mode scope", () => {
     expect(GCManager.perfSize).toBe(mark1);
   });
 
+  it("perf mode roots bulk-wrapped values until scope end", () => {
+    const initialSize = GCManager.perfSize;
+
+    const values = Julia.scope((julia) => {
+      const arr = julia.Array.from(
+        Float64Array.from({ length: 300 }, (_, i) => i),
+      );
+      const wrapped = [...arr];
+      expect(GCManager.perfSize).toBeGreaterThan(initialSize + 300);
+      julia.eval("GC.gc()");
+      return wrapped.map((v) => v.value);
+    });
+
+    expect(values).toEqual(Array.from({ length: 300 }, (_, i) => i));
+    expect(GCManager.perfSize).toBe(initialSize);
+  });
+
+  it("perf mode activity shows up in stats and scope summaries", () => {
+    const before = GCManager.stats();
+    let summary: ScopeSummary | undefined;
+    GCManager.onScopeSummary = (s) => (summary = s);
+    try {
+      Julia.scope((julia) => {
+        julia.Array.init(julia.Float64, 10);
+        julia.Array.init(julia.Float64, 10);
+      });
+    } finally {
+      GCManager.onScopeSummary = null;
+    }
+    const after = GCManager.stats();
+
+    expect(after.perfPushes - before.perfPushes).toBeGreaterThanOrEqual(2);
+    expect(after.perfReleases - before.perfReleases).toBe(
+      after.perfPushes - before.perfPushes,
+    );
+    expect(after.perfSize).toBe(before.perfSize);
+    expect(after.perfHighWater).toBeGreaterThanOrEqual(before.perfSize + 2);
+    expect(summary?.mode).toBe("perf");
+    expect(summary?.released).toBe(after.perfReleases - before.perfReleases);
+    expect(summary?.tracked).toBe(summary?.released);
+    expect(summary?.tracked).toBeGreaterThanOrEqual(2);
+  });
+
   it("perf mode escape works", () => {
     let escaped: JuliaArray | null = null;
 
@@ -454,6 +454,71 @@ describe("JuliaSubArray", () => {
     });
   });
 
+  describe("Strided layout", () => {
+    test("layout of a matrix row view", () => {
+      const data = Float64Array.from({ length: 12 }, (_, i) => i + 1);
+      const matrix = JuliaArray.from(data, { shape: [3, 4] });
+      const row = matrix.view(1, ":");
+      const layout = row.layout!;
+      expect(layout).not.toBeNull();
+      expect(layout.elsize).toBe(8);
+      expect(layout.shape).toEqual([4]);
+      expect(layout.strides).toEqual([3]);
+      expect(layout.contiguous).toBe(false);
+
+      const view = row.stridedView()!;
+      expect(view.data[view.offset + 2 * view.strides[0]]).toBe(8);
+      // Zero-copy: writes through the parent show up in the view
+      data[10] = -1;
+      expect(view.data[view.offset + 3 * view.strides[0]]).toBe(-1);
+    });
+
+    test("contiguous views wrap exactly their elements", () => {
+      const arr = JuliaArray.from(new Int32Array([1, 2, 3, 4, 5, 6]));
+      const sub = arr.slice(1, 4);
+      expect(sub.layout!.contiguous).toBe(true);
+      const view = sub.stridedView()!;
+      expect(view.data).toEqual(new Int32Array([2, 3, 4, 5]));
+      expect(view.offset).toBe(0);
+    });
+
+    test("gatherInto copies strided and reversed views", () => {
+      const matrix = Julia.eval("reshape(Float64.(1:24), 4, 6)") as JuliaArray;
+      const sub = matrix.view([0, 2, 2], [5, -2, 1]); // rows 1,3 / cols 6,4,2
+      expect(sub.size).toEqual([2, 3]);
+      expect(sub.layout!.strides).toEqual([2, -8]);
+
+      const out = new Float64Array(8);
+      expect(sub.gatherInto(out)).toBe(6);
+      expect(Array.from(out.subarray(0, 6))).toEqual([21, 23, 13, 15, 5, 7]);
+      expect(sub.value).toEqual(new Float64Array([21, 23, 13, 15, 5, 7]));
+
+      expect(() => sub.gatherInto(new Float64Array(5))).toThrow(RangeError);
+      expect(() => sub.gatherInto(new Float32Array(6))).toThrow(TypeError);
+    });
+
+    test("views of views and dropped dimensions", () => {
+      const tensor = Julia.eval("reshape(Int64.(1:60), 3, 4, 5)") as JuliaArray;
+      const slab = tensor.view(":", [1, 3], 2); // 3x3, k = 3
+      const inner = slab.view([0, 2, 2], 1); // rows 1,3 of column 2
+      expect(inner.layout!.shape).toEqual([2]);
+      expect(inner.value).toEqual(new BigInt64Array([31n, 33n]));
+      expect(inner.fastValue).toBeNull();
+    });
+
+    test("non-strided views fall back to Julia", () => {
+      const arr = JuliaArray.from(new Float64Array([1, 2, 3, 4, 5]));
+      const picked = Julia.Base.view(
+        arr,
+        JuliaArray.from(new BigInt64Array([5n, 1n, 3n])),
+      ) as JuliaSubArray;
+      expect(picked.layout).toBeNull();
+      expect(picked.stridedView()).toBeNull();
+      expect(picked.value).toEqual(new Float64Array([5, 1, 3]));
+      expect(() => picked.gatherInto(new Float64Array(3))).toThrow(TypeError);
+    });
+  });
+
   describe("Type detection in wrapPtr", () => {
     test("Julia function returning SubArray is correctly wrapped", () => {
       const getSubArray = Julia.eval(`
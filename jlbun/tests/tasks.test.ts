@@ -1,5 +1,11 @@
 import { beforeAll, describe, expect, it } from "bun:test";
-import { Julia, JuliaFunction, JuliaTask, MethodError } from "../index.js";
+import {
+  Julia,
+  JuliaArray,
+  JuliaFunction,
+  JuliaTask,
+  MethodError,
+} from "../index.js";
 import { ensureJuliaInitialized, useJuliaTestScope } from "./setup.js";
 
 beforeAll(() => ensureJuliaInitialized());
@@ -42,6 +48,161 @@ describe("JuliaTask", () => {
   });
 });
 
+describe("JuliaTask completion", () => {
+  it("does not block the event loop while the task runs", async () => {
+    const func = Julia.eval("() -> (sleep(0.2); 42)") as JuliaFunction;
+    const order: string[] = [];
+    const timer = new Promise<void>((resolve) =>
+      setTimeout(() => {
+        order.push("timer");
+        resolve();
+      }, 10),
+    );
+    const result = JuliaTask.from(func).value.then((value) => {
+      order.push("task");
+      return value.value;
+    });
+    await Promise.all([timer, result]);
+    expect(order).toEqual(["timer", "task"]);
+    expect(await result).toBe(42n);
+  });
+
+  it("rejects with the exception of a failed task", async () => {
+    const func = Julia.eval('() -> error("boom")') as JuliaFunction;
+    const error = await JuliaTask.from(func).value.then(
+      () => null,
+      (err) => err,
+    );
+    expect(Julia.string(error)).toContain("boom");
+  });
+});
+
+describe("Julia.parallel", () => {
+  it("maps chunks of an array across threads", async () => {
+    const n = 1000;
+    const xs = JuliaArray.from(Float64Array.from({ length: n }, (_, i) => i));
+    const ys = await Julia.parallel.map(Julia.Base.sqrt, xs, { chunks: 7 });
+    expect(ys.value).toEqual(
+      Float64Array.from({ length: n }, (_, i) => Math.sqrt(i)),
+    );
+
+    const out = JuliaArray.init(Julia.Float64, n);
+    const result = await Julia.parallel.map(Julia.Base.sqrt, xs, { out });
+    expect(Julia.Base["==="](result, out).value).toBe(true);
+    expect(out.value).toEqual(ys.value);
+
+    expect(() =>
+      Julia.parallel.map(Julia.Base.sqrt, xs, {
+        out: JuliaArray.init(Julia.Float64, 3),
+      }),
+    ).toThrow("do not match");
+    expect(() =>
+      Julia.parallel.map(Julia.Base.sqrt, xs, { chunks: 0 }),
+    ).toThrow(RangeError);
+  });
+
+  it("reduces chunks of an array across threads", async () => {
+    const xs = Julia.eval("collect(1:100)") as JuliaArray;
+    const sumsq = await Julia.parallel.reduce(
+      Julia.Base["+"],
+      Julia.Base.abs2,
+      xs,
+      { chunks: 3 },
+    );
+    expect(sumsq.value).toBe(338350n);
+
+    const empty = Julia.eval("Int[]") as JuliaArray;
+    const error = await Julia.parallel
+      .reduce(Julia.Base["+"], Julia.Base.abs2, empty)
+      .then(
+        () => null,
+        (err) => err,
+      );
+    expect(error).not.toBeNull();
+  });
+
+  it("runs with a single Julia thread", () => {
+    // Julia is initialized once per process, so use a fresh one
+    const script = `
+      import { Julia } from ${JSON.stringify(`${import.meta.dir}/../index.js`)};
+      Julia.init();
+      const result = await Julia.scopeAsync(async (julia) => {
+        const xs = julia.Array.from(new Float64Array([1, 4, 9]));
+        const ys = await Julia.parallel.map(julia.Base.sqrt, xs);
+        const sumsq = await Julia.parallel.reduce(
+          julia.Base["+"],
+          julia.Base.abs2,
+          xs,
+        );
+        const spawned = await julia.eval("Threads.@spawn 1 + 1").value;
+        const sums = [sumsq.value, Number(spawned.value)];
+        return [Julia.nthreads, ...ys.value, ...sums];
+      });
+      console.log(JSON.stringify(result));
+      Julia.close();
+    `;
+    const proc = Bun.spawnSync([process.execPath, "-e", script], {
+      env: { ...process.env, JULIA_NUM_THREADS: "1" },
+    });
+    expect(proc.stderr.toString()).not.toContain("Task not runnable");
+    expect(proc.exitCode).toBe(0);
+    expect(JSON.parse(proc.stdout.toString())).toEqual([1, 1, 2, 3, 98, 2]);
+  });
+});
+
+describe("Julia.rpc", () => {
+  it("pipelines calls through the worker pool", async () => {
+    // A small capacity makes most calls wait for a free slot
+    Julia.rpc.start({ workers: 2, capacity: 4 });
+    expect(Julia.rpc.running()).toBe(true);
+    expect(() => Julia.rpc.start()).toThrow("already running");
+
+    const results = await Promise.all(
+      Array.from({ length: 50 }, (_, i) => Julia.rpc.call(Julia.Base.abs2, i)),
+    );
+    expect(results.map((r) => r.value)).toEqual(
+      Array.from({ length: 50 }, (_, i) => BigInt(i * i)),
+    );
+
+    await expect(Julia.rpc.call(Julia.Base.sqrt, -1)).rejects.toThrow(
+      "DomainError",
+    );
+
+    await Julia.rpc.stop();
+    expect(Julia.rpc.running()).toBe(false);
+    await expect(Julia.rpc.call(Julia.Base.sqrt, 1)).rejects.toThrow(
+      "not running",
+    );
+  });
+
+  it("rejects backlogged calls of disposed scopes", async () => {
+    Julia.rpc.start({ workers: 1, capacity: 1 });
+    try {
+      const slow = Julia.eval("x -> (sleep(0.2); x)") as JuliaFunction;
+      const first = Julia.rpc.call(slow, 1);
+      // The only slot is taken, so this call waits in the backlog while its
+      // scope (and the rooted argument) goes away
+      const orphan = Julia.scope(() => Julia.rpc.call(Julia.Base.abs2, 3));
+      await expect(orphan).rejects.toThrow("disposed");
+      expect((await first).value).toBe(1n);
+    } finally {
+      await Julia.rpc.stop();
+    }
+  });
+
+  it("does not restart until the workers have exited", async () => {
+    Julia.rpc.start({ workers: 2 });
+    const stopped = Julia.rpc.stop();
+    expect(Julia.rpc.running()).toBe(false);
+    expect(() => Julia.rpc.start()).toThrow("still stopping");
+    await stopped;
+
+    Julia.rpc.start({ workers: 2 });
+    expect((await Julia.rpc.call(Julia.Base.abs2, 4)).value).toBe(16n);
+    await Julia.rpc.stop();
+  });
+});
+
 describe("JuliaTask additional coverage", () => {
   it("schedule throws when task cannot be rescheduled", () => {
     // Create a task from Julia directly (not via from())
@@ -1,5 +1,8 @@
 import { FFIType } from "bun:ffi";
 import { beforeAll, describe, expect, it } from "bun:test";
+import { mkdtempSync, readFileSync, statSync, writeFileSync } from "fs";
+import { tmpdir } from "os";
+import { join } from "path";
 import {
   ArgumentError,
   BoundsError,
@@ -22,7 +25,10 @@ import {
   UndefVarError,
   UnknownJuliaError,
 } from "../errors.js";
-import { Julia, JuliaArray, JuliaDict } from "../index.js";
+import { Julia, JuliaArray, JuliaDict, JuliaModule } from "../index.js";
+import { JULIA_MODULE_CACHE } from "../modules.js";
+import { closeHotBindings, loadHotBindings } from "../prefetch.js";
+import { checkSysimageManifest, sysimageManifestPath } from "../sysimage.js";
 import { mapFFITypeToJulia } from "../utils.js";
 import { ensureJuliaInitialized, useJuliaTestScope } from "./setup.js";
 
@@ -116,6 +122,94 @@ describe("mapFFITypeToJulia coverage", () => {
   });
 });
 
+describe("Sysimage manifest", () => {
+  it("resolves the manifest next to the image", () => {
+    expect(sysimageManifestPath("/julia/bin", "/b/sysimage.so")).toBe(
+      "/b/sysimage.json",
+    );
+    expect(sysimageManifestPath("/julia/bin", "../lib/sys.dylib")).toBe(
+      "/julia/lib/sys.json",
+    );
+  });
+
+  it("reports stale sysimages", () => {
+    const dir = mkdtempSync(join(tmpdir(), "jlbun-sysimage-"));
+    const manifestPath = join(dir, "sysimage.json");
+    const trace = join(dir, "a.jl");
+    writeFileSync(trace, "precompile(Tuple{typeof(sin), Float64})\n");
+    const stat = statSync(trace);
+    const write = (julia: string, size = stat.size) =>
+      writeFileSync(
+        manifestPath,
+        JSON.stringify({
+          julia,
+          created: Date.now() / 1000,
+          traceDir: dir,
+          traces: [{ path: trace, mtime: stat.mtimeMs / 1000, size }],
+          statements: 1,
+        }),
+      );
+
+    expect(checkSysimageManifest(join(dir, "none.json"), "1.11.0")).toBeNull();
+    write("1.11.0");
+    expect(checkSysimageManifest(manifestPath, "1.11.0")).toBeNull();
+    expect(checkSysimageManifest(manifestPath, "1.12.0")).toContain(
+      "built with Julia 1.11.0",
+    );
+    write("1.11.0", stat.size + 1);
+    expect(checkSysimageManifest(manifestPath, "1.11.0")).toContain(
+      "changed since the build",
+    );
+    write("1.11.0");
+    writeFileSync(join(dir, "b.jl"), "");
+    expect(checkSysimageManifest(manifestPath, "1.11.0")).toContain(
+      "new trace",
+    );
+  });
+});
+
+describe("Init profile and hot bindings", () => {
+  it("reports the phases of Julia.init", () => {
+    const profile = Julia.initProfile;
+    const phases = [
+      profile.jlInit,
+      profile.typeGetters,
+      profile.modules,
+      profile.project,
+      profile.evals,
+      profile.gcInit,
+      profile.prefetch,
+    ];
+    for (const ms of phases) {
+      expect(ms).toBeGreaterThanOrEqual(0);
+    }
+    const sum = phases.reduce((a, b) => a + b, 0);
+    expect(profile.total).toBeCloseTo(sum, 6);
+  });
+
+  it("warms recorded bindings and saves the ones looked up", async () => {
+    const dir = mkdtempSync(join(tmpdir(), "jlbun-hot-"));
+    const path = join(dir, "hot.json");
+    writeFileSync(
+      path,
+      JSON.stringify(["Base.Threads.nthreads", "Base.__jlbun_missing__"]),
+    );
+
+    loadHotBindings(path);
+    await Bun.sleep(20);
+    const threads = Julia.Base.Threads as JuliaModule;
+    expect(threads[JULIA_MODULE_CACHE].has("nthreads")).toBe(true);
+    Julia.unsafe.eval("__jlbun_hot_binding__(x) = x");
+    void Julia.Main.__jlbun_hot_binding__;
+    closeHotBindings();
+
+    const saved = JSON.parse(readFileSync(path, "utf8")) as string[];
+    expect(saved).toContain("Base.Threads.nthreads");
+    expect(saved).toContain("Main.__jlbun_hot_binding__");
+    expect(saved).not.toContain("Base.__jlbun_missing__");
+  });
+});
+
 describe("Error classes", () => {
   it("all error classes extend JuliaError", () => {
     const errors = [
@@ -2,17 +2,30 @@ import { beforeAll, describe, expect, it } from "bun:test";
 import {
   Julia,
   JuliaAny,
+  JuliaArray,
   JuliaBool,
   JuliaChar,
+  JuliaComplex,
+  JuliaDataType,
+  JuliaDict,
   JuliaFloat16,
   JuliaFloat32,
   JuliaFloat64,
+  JuliaFunction,
+  JuliaIdDict,
   JuliaInt8,
   JuliaInt16,
   JuliaInt32,
   JuliaInt64,
+  JuliaModule,
+  JuliaNamedTuple,
+  JuliaPair,
+  JuliaRange,
+  JuliaSet,
   JuliaString,
+  JuliaSubArray,
   JuliaSymbol,
+  JuliaTuple,
   JuliaUInt8,
   JuliaUInt16,
   JuliaUInt32,
@@ -347,3 +360,51 @@ describe("JuliaDataType methods", () => {
     expect(Julia.String.value).toBe("String");
   });
 });
+
+describe("wrapPtr type classification", () => {
+  it("picks the wrapper by type name", () => {
+    const cases: [string, unknown][] = [
+      ["[1, 2]", JuliaArray],
+      ["view([1, 2, 3], 1:2)", JuliaSubArray],
+      ["(1, 2)", JuliaTuple],
+      ["(a = 1,)", JuliaNamedTuple],
+      ["1 => 2", JuliaPair],
+      ["Set([1])", JuliaSet],
+      ['Dict("a" => 1)', JuliaDict],
+      ["IdDict(1 => 2)", JuliaIdDict],
+      ["1:3", JuliaRange],
+      ["0.0:0.5:1.0", JuliaRange],
+      ["1.0f0 + 2.0f0im", JuliaComplex],
+      ["sin", JuliaFunction],
+      ["x -> x", JuliaFunction],
+      ["Float64", JuliaDataType],
+      ["Vector", JuliaDataType],
+      ["Base", JuliaModule],
+      [":a", JuliaSymbol],
+      ["1 + 2im", JuliaAny],
+      ["Some(1)", JuliaAny],
+    ];
+    for (const [code, wrapper] of cases) {
+      // Wrap twice: the second one uses the constructor cached for the type
+      expect(Julia.eval(code)).toBeInstanceOf(wrapper as typeof JuliaAny);
+      expect(Julia.eval(code)).toBeInstanceOf(wrapper as typeof JuliaAny);
+    }
+  });
+
+  it("keeps per-type details of parametric families", () => {
+    const ints = Julia.eval("Int32[1, 2]") as JuliaArray;
+    const floats = Julia.eval("[1.5, 2.5]") as JuliaArray;
+    expect(ints.elType.isEqual(Julia.Int32)).toBe(true);
+    expect(floats.elType.isEqual(Julia.Float64)).toBe(true);
+    expect((Julia.eval("Int32[3]") as JuliaArray).value).toEqual(
+      new Int32Array([3]),
+    );
+
+    const sin = Julia.eval("sin") as JuliaFunction;
+    const cos = Julia.eval("cos") as JuliaFunction;
+    expect(sin.name).toBe("sin");
+    expect(cos.name).toBe("cos");
+    expect((Julia.eval("Float32") as JuliaDataType).name).toBe("Float32");
+    expect((Julia.eval("Int8") as JuliaDataType).name).toBe("Int8");
+  });
+});
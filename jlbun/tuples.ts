@@ -1,6 +1,38 @@
 /* eslint-disable @typescript-eslint/no-explicit-any */
 import { Pointer } from "bun:ffi";
-import { jlbun, Julia, JuliaFunction, JuliaValue } from "./index.js";
+import {
+  jlbun,
+  Julia,
+  JuliaFunction,
+  JuliaValue,
+  safeCString,
+} from "./index.js";
+
+// `NamedTuple{names}` types by key set, bound to `const` globals in `Main`
+const namedTupleTypes: Map<string, Pointer> = new Map();
+
+/**
+ * Get the `NamedTuple{names}` type for a key set, defined on first use.
+ *
+ * @internal
+ */
+export function namedTupleType(keys: string[]): Pointer {
+  const id = JSON.stringify(keys);
+  let type = namedTupleTypes.get(id);
+  if (type === undefined) {
+    const binding = `__jlbun_namedtuple_${namedTupleTypes.size}__`;
+    const names = keys
+      .map((key) => `Symbol(${JSON.stringify(key).replaceAll("$", "\\$")}),`)
+      .join(" ");
+    Julia.unsafe.eval(`const ${binding} = NamedTuple{(${names})}`);
+    type = jlbun.symbols.jl_function_getter(
+      Julia.Main.ptr,
+      safeCString(binding),
+    )!;
+    namedTupleTypes.set(id, type);
+  }
+  return type;
+}
 
 /**
  * Wrapper for Julia `Tuple`.
@@ -37,7 +69,12 @@ export class JuliaTuple implements JuliaValue {
   }
 
   get value(): any[] {
-    return Array.from({ length: this.length }, (_, i) => this.get(i).value);
+    if (this.length === 0) {
+      return [];
+    }
+    // Fetch and root every field in one go
+    const fields = jlbun.symbols.jlbun_get_fields(this.ptr)!;
+    return Julia.wrapVector(fields, this.length).map((field) => field.value);
   }
 
   toString(): string {
@@ -119,15 +156,16 @@ export class JuliaNamedTuple implements JuliaValue {
       return Julia.Core.NamedTuple() as JuliaNamedTuple;
     }
 
-    const tupleType = Julia.eval(
-      `NamedTuple{(${keys.map((key) => `Symbol("${key}")`).join(",")},)}`,
+    // Build the tuple from the cached type and the values in one call
+    const values = Julia.autoWrapMany(keys.map((key) => obj[key]));
+    const ptr = jlbun.symbols.jlbun_namedtuple_new(
+      namedTupleType(keys),
+      new BigInt64Array(values.map((value) => BigInt(value.ptr))),
+      values.length,
     );
-    const values = JuliaTuple.from(...keys.map((key) => obj[key]));
-    const ptr = jlbun.symbols.jl_call1(tupleType.ptr, values.ptr);
     if (ptr === null) {
       throw new Error("Failed to create Julia named tuple from object");
     }
-    Julia.handleCallException(tupleType as JuliaFunction, [values]);
     return Julia.adoptValue(new JuliaNamedTuple(ptr, keys));
   }
 
@@ -149,9 +187,7 @@ export class JuliaNamedTuple implements JuliaValue {
       return new JuliaNamedTuple(ptr, keys);
     }
 
-    const tupleType = Julia.unsafe.eval(
-      `NamedTuple{(${keys.map((key) => `Symbol("${key}")`).join(",")},)}`,
-    );
+    const tupleType = Julia.unsafe.wrapPtr(namedTupleType(keys));
     const values = JuliaTuple.unsafeFrom(...keys.map((key) => obj[key]));
     const ptr = jlbun.symbols.jl_call1(tupleType.ptr, values.ptr);
     if (ptr === null) {
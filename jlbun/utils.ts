@@ -1,4 +1,5 @@
 import { FFIType, FFITypeOrString, Pointer, ptr } from "bun:ffi";
+import { Julia, JuliaFunction } from "./index.js";
 
 export function safeCString(s: string): Pointer {
   return ptr(Buffer.from(s + "\x00"));
@@ -51,3 +52,68 @@ export function mapFFITypeToJulia(type: FFITypeOrString): string {
     return "Ptr{Nothing}";
   }
 }
+
+const SIGNATURE_TYPES = new Set([
+  "i8",
+  "u8",
+  "i16",
+  "u16",
+  "i32",
+  "u32",
+  "i64",
+  "u64",
+  "f32",
+  "f64",
+  "bool",
+  "ptr",
+]);
+
+/**
+ * Parse a native signature such as `(f64, ptr, i64) -> f64`.
+ *
+ * Only fixed-size Bun FFI types are accepted; `void` is allowed as the
+ * return type.
+ */
+export function parseFFISignature(signature: string): {
+  args: FFITypeOrString[];
+  returns: FFITypeOrString;
+} {
+  const match = /^\s*\(([^)]*)\)\s*->\s*(\w+)\s*$/.exec(signature);
+  if (match === null) {
+    throw new SyntaxError(`Invalid signature: ${signature}`);
+  }
+  const args = match[1].trim() === "" ? [] : match[1].split(",");
+  const parsedArgs = args.map((arg) => arg.trim());
+  const returns = match[2];
+  for (const type of parsedArgs) {
+    if (!SIGNATURE_TYPES.has(type)) {
+      throw new TypeError(`Unsupported argument type in signature: ${type}`);
+    }
+  }
+  if (returns !== "void" && !SIGNATURE_TYPES.has(returns)) {
+    throw new TypeError(`Unsupported return type in signature: ${returns}`);
+  }
+  return {
+    args: parsedArgs as FFITypeOrString[],
+    returns: returns as FFITypeOrString,
+  };
+}
+
+const helpers: Map<string, JuliaFunction> = new Map();
+
+/**
+ * Julia helper function bound to a constant in `Main`, defined on first
+ * use.
+ *
+ * @internal
+ */
+export function juliaHelper(name: string, code: string): JuliaFunction {
+  let helper = helpers.get(name);
+  if (helper === undefined) {
+    const binding = `__jlbun_${name}__`;
+    Julia.unsafe.eval(`const ${binding} = ${code}`);
+    helper = Julia.getFunction(Julia.Main, binding);
+    helpers.set(name, helper);
+  }
+  return helper;
+}
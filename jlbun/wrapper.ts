@@ -18,6 +18,10 @@ export const jlbun = dlopen(LIBJLBUN_PATH, {
     args: [FFIType.cstring, FFIType.cstring],
     returns: FFIType.void,
   },
+  jlbun_set_trace_compile: {
+    args: [FFIType.cstring], // path of the precompile statements file
+    returns: FFIType.void,
+  },
 
   // Data types
   jl_any_type_getter: {
@@ -178,6 +182,10 @@ export const jlbun = dlopen(LIBJLBUN_PATH, {
     args: [FFIType.ptr],
     returns: FFIType.ptr,
   },
+  jlbun_classify_type: {
+    args: [FFIType.ptr, FFIType.ptr], // type, element type out
+    returns: FFIType.i32, // JLBUN_KIND_*
+  },
   jl_is_function_value: {
     args: [FFIType.ptr],
     returns: FFIType.i8,
@@ -236,11 +244,11 @@ export const jlbun = dlopen(LIBJLBUN_PATH, {
   },
   jlbun_gc_scope_end: {
     args: [FFIType.u64], // scope_id to release
-    returns: FFIType.void,
+    returns: FFIType.u64, // released slots
   },
   jlbun_gc_transfer: {
     args: [FFIType.u64, FFIType.u64], // idx, new_scope_id
-    returns: FFIType.u64, // same idx or SIZE_MAX on error
+    returns: FFIType.u64, // new idx (may change shard) or SIZE_MAX on error
   },
   jlbun_gc_get_scope: {
     args: [FFIType.u64], // idx
@@ -258,6 +266,14 @@ export const jlbun = dlopen(LIBJLBUN_PATH, {
     args: [FFIType.u64], // index
     returns: FFIType.void,
   },
+  jlbun_gc_push_scoped_many: {
+    args: [FFIType.ptr, FFIType.u64, FFIType.u64, FFIType.ptr], // values, n, scope_id, out: indices
+    returns: FFIType.u64, // n, or 0 on error
+  },
+  jlbun_gc_release_many: {
+    args: [FFIType.ptr, FFIType.u64], // indices, n
+    returns: FFIType.void,
+  },
   jlbun_gc_size: {
     args: [],
     returns: FFIType.u64,
@@ -274,6 +290,38 @@ export const jlbun = dlopen(LIBJLBUN_PATH, {
     args: [],
     returns: FFIType.void,
   },
+  jlbun_gc_segment_size: {
+    args: [],
+    returns: FFIType.u64,
+  },
+  jlbun_gc_set_idle_threshold: {
+    args: [FFIType.u64], // milliseconds
+    returns: FFIType.void,
+  },
+  jlbun_gc_get_idle_threshold: {
+    args: [],
+    returns: FFIType.u64, // milliseconds
+  },
+  jlbun_gc_trim: {
+    args: [],
+    returns: FFIType.u64, // released segments
+  },
+  jlbun_gc_shard_count: {
+    args: [],
+    returns: FFIType.u64,
+  },
+  jlbun_gc_scope_shard: {
+    args: [FFIType.u64], // scope_id
+    returns: FFIType.u64, // shard index
+  },
+  jlbun_gc_shard_stats: {
+    args: [FFIType.ptr], // out: uint64[shard_count * 4]
+    returns: FFIType.void,
+  },
+  jlbun_gc_stats: {
+    args: [FFIType.ptr], // out: JlbunGCStats (uint64[22])
+    returns: FFIType.void,
+  },
   // Perf mode GC (lock-free, single-threaded)
   jlbun_gc_perf_init: {
     args: [FFIType.u64], // initial_capacity
@@ -287,6 +335,10 @@ export const jlbun = dlopen(LIBJLBUN_PATH, {
     args: [FFIType.ptr], // value
     returns: FFIType.u64, // index
   },
+  jlbun_gc_perf_push_many: {
+    args: [FFIType.ptr, FFIType.u64], // values, n
+    returns: FFIType.u64, // first index
+  },
   jlbun_gc_perf_release: {
     args: [FFIType.u64], // mark position
     returns: FFIType.void,
@@ -308,6 +360,33 @@ export const jlbun = dlopen(LIBJLBUN_PATH, {
     returns: FFIType.void,
   },
 
+  // Batched calls
+  jlbun_call_batch: {
+    args: [
+      FFIType.ptr, // ops
+      FFIType.u64, // ops_len
+      FFIType.ptr, // inputs
+      FFIType.u64, // ninputs
+      FFIType.u64, // ncalls
+      FFIType.ptr, // failed (out)
+    ],
+    returns: FFIType.ptr, // Vector{Any} of results
+  },
+
+  // Bulk wrapping helpers
+  jlbun_box_many: {
+    args: [FFIType.ptr, FFIType.ptr, FFIType.u64], // kinds, payload, n
+    returns: FFIType.ptr, // Vector{Any}
+  },
+  jlbun_array_box_range: {
+    args: [FFIType.ptr, FFIType.u64, FFIType.u64], // array, start, n
+    returns: FFIType.ptr, // Vector{Any}
+  },
+  jlbun_get_fields: {
+    args: [FFIType.ptr],
+    returns: FFIType.ptr, // Vector{Any}
+  },
+
   // Auto generated wrappers
   jl_gc_enable: {
     args: [FFIType.i32],
@@ -515,6 +594,90 @@ export const jlbun = dlopen(LIBJLBUN_PATH, {
     args: [FFIType.ptr, FFIType.ptr, FFIType.u64],
     returns: FFIType.ptr,
   },
+  jlbun_ptr_to_array_nd: {
+    args: [
+      FFIType.ptr, // array type
+      FFIType.ptr, // data
+      FFIType.ptr, // dims
+      FFIType.u64, // ndims
+      FFIType.i32, // own_buffer
+      FFIType.i32, // row_major
+    ],
+    returns: FFIType.ptr, // Array, or PermutedDimsArray view if row_major
+  },
+  jlbun_strided_layout: {
+    args: [FFIType.ptr, FFIType.ptr], // array or SubArray, layout out
+    returns: FFIType.i32, // 1 if strided
+  },
+  jlbun_array_read: {
+    args: [
+      FFIType.ptr, // array
+      FFIType.u64, // offset
+      FFIType.u64, // count
+      FFIType.ptr, // element type of out
+      FFIType.ptr, // out
+      FFIType.ptr, // validity bitmap, or null
+    ],
+    returns: FFIType.i64, // count, or -(i + 1) if element i failed
+  },
+  jlbun_array_write: {
+    args: [
+      FFIType.ptr, // array
+      FFIType.u64, // offset
+      FFIType.u64, // count
+      FFIType.ptr, // element type of src
+      FFIType.ptr, // src
+      FFIType.ptr, // validity bitmap, or null
+    ],
+    returns: FFIType.i64, // count, or -(i + 1) if element i failed
+  },
+  jlbun_f16_to_f32: {
+    args: [FFIType.ptr, FFIType.ptr, FFIType.u64], // Float16 bits, out, n
+    returns: FFIType.void,
+  },
+  jlbun_f32_to_f16: {
+    args: [FFIType.ptr, FFIType.ptr, FFIType.u64], // Float32, bits out, n
+    returns: FFIType.void,
+  },
+  jlbun_f16_simd: {
+    args: [],
+    returns: FFIType.i32, // 1 if the F16C or NEON kernels are in use
+  },
+  jlbun_vector_from_packed: {
+    args: [
+      FFIType.i32, // element kind
+      FFIType.ptr, // packed values (UTF-8 bytes for strings)
+      FFIType.ptr, // string offsets, or null
+      FFIType.ptr, // validity bitmap, or null
+      FFIType.u64, // length
+    ],
+    returns: FFIType.ptr, // Vector{T} or Vector{Union{Nothing, T}}
+  },
+  jlbun_strings_from_packed: {
+    args: [
+      FFIType.ptr, // UTF-8 bytes
+      FFIType.ptr, // offsets
+      FFIType.i32, // offset width (4 or 8)
+      FFIType.ptr, // validity bitmap, or null
+      FFIType.u64, // length
+    ],
+    returns: FFIType.ptr, // Vector{String} or Vector{Union{Nothing, String}}
+  },
+  jlbun_strings_to_packed: {
+    args: [
+      FFIType.ptr, // array
+      FFIType.ptr, // UTF-8 bytes out
+      FFIType.u64, // byte capacity
+      FFIType.ptr, // offsets out (length + 1)
+      FFIType.i32, // offset width (4 or 8)
+      FFIType.ptr, // validity bitmap out, or null
+    ],
+    returns: FFIType.i64, // total bytes, or negative on error
+  },
+  jlbun_strided_gather: {
+    args: [FFIType.ptr, FFIType.ptr, FFIType.u64], // layout, out, out length
+    returns: FFIType.i64, // elements copied, -1 if out is too small
+  },
   jl_cstr_to_string: {
     args: [FFIType.cstring],
     returns: FFIType.ptr,
@@ -595,4 +758,53 @@ export const jlbun = dlopen(LIBJLBUN_PATH, {
     args: [FFIType.ptr, FFIType.i32],
     returns: FFIType.i32,
   },
+  jlbun_namedtuple_new: {
+    args: [FFIType.ptr, FFIType.ptr, FFIType.u64], // NamedTuple{names}, values
+    returns: FFIType.ptr,
+  },
+  jlbun_call_kwargs: {
+    // NamedTuple{names} (or null), kw values, nkw, f, args, nargs
+    args: [
+      FFIType.ptr,
+      FFIType.ptr,
+      FFIType.u64,
+      FFIType.ptr,
+      FFIType.ptr,
+      FFIType.u64,
+    ],
+    returns: FFIType.ptr, // result, or null if the call threw
+  },
+  jlbun_callback_new: {
+    args: [FFIType.ptr, FFIType.ptr], // trampoline type, JSCallback address
+    returns: FFIType.ptr,
+  },
+  jlbun_task_watch: {
+    args: [FFIType.ptr, FFIType.u64], // task, completion ID
+    returns: FFIType.ptr, // nothing, or null on failure
+  },
+  jlbun_task_poll: {
+    args: [FFIType.ptr, FFIType.u64, FFIType.i32], // IDs out, capacity, yield
+    returns: FFIType.i64, // IDs drained, or -1 if some were dropped
+  },
+  jlbun_rpc_start: {
+    args: [FFIType.u64, FFIType.i32], // capacity, workers
+    returns: FFIType.ptr, // Task finishing with the workers, or null
+  },
+  jlbun_rpc_submit: {
+    args: [FFIType.ptr, FFIType.ptr, FFIType.u64], // f, args, nargs
+    returns: FFIType.i64, // slot, -1 if full, -2 if not running
+  },
+  jlbun_rpc_drain: {
+    // slots out, values out, failed flags out, capacity, yield
+    args: [FFIType.ptr, FFIType.ptr, FFIType.ptr, FFIType.u64, FFIType.i32],
+    returns: FFIType.i64, // number of finished calls
+  },
+  jlbun_rpc_release: {
+    args: [FFIType.ptr, FFIType.u64], // slots, count
+    returns: FFIType.void,
+  },
+  jlbun_rpc_stop: {
+    args: [],
+    returns: FFIType.void,
+  },
 });
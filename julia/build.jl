@@ -1,9 +1,93 @@
+# Build a sysimage from traced jlbun workloads.
+#
+#   julia --project=julia julia/build.jl [trace files or directories...]
+#
+# Traces are files of `precompile(...)` statements written by jlbun scripts
+# run with `JLBUN_TRACE_COMPILE=<file>` (see `just sysimage-trace`). They
+# default to every `build/trace/*.jl`. The statements are deduplicated and
+# compiled into `build/sysimage.$dlext` together with the workload in
+# `precompile.jl`, and `build/sysimage.json` records what the image was built
+# from so that `Julia.init` can warn when it is stale.
+
 using Libdl
 using PackageCompiler
 
-PackageCompiler.create_sysimage(;
-                                sysimage_path = joinpath(@__DIR__,
-                                                         "..",
-                                                         "build",
-                                                         "sysimage.$dlext"),
-                                precompile_execution_file = "precompile.jl")
+const BUILD_DIR = normpath(joinpath(@__DIR__, "..", "build"))
+const TRACE_DIR = joinpath(BUILD_DIR, "trace")
+
+function trace_files(args)
+    paths = isempty(args) ? [TRACE_DIR] : abspath.(args)
+    files = String[]
+    for path in paths
+        if isdir(path)
+            append!(files,
+                    sort!(filter(endswith(".jl"), readdir(path; join = true))))
+        elseif isfile(path)
+            push!(files, path)
+        else
+            @warn "Skipping missing trace $path"
+        end
+    end
+    return files
+end
+
+# Statements naming definitions that only exist at runtime (jlbun's helpers,
+# callback trampolines and anonymous functions evaluated into `Main`) cannot
+# be compiled into the image.
+is_portable(statement) = !occursin("Main.", statement)
+
+function collect_statements(files)
+    statements = String[]
+    seen = Set{String}()
+    skipped = 0
+    for file in files, line in eachline(file)
+        startswith(line, "precompile(") || continue
+        line in seen && continue
+        push!(seen, line)
+        if is_portable(line)
+            push!(statements, line)
+        else
+            skipped += 1
+        end
+    end
+    return statements, skipped
+end
+
+json(x::AbstractString) = "\"" * escape_string(x) * "\""
+json(x::Real) = string(x)
+json(::Nothing) = "null"
+json(xs::AbstractVector) = "[" * join(json.(xs), ", ") * "]"
+function json(d::AbstractDict)
+    fields = ["$(json(string(k))): $(json(v))" for (k, v) in d]
+    return "{" * join(fields, ", ") * "}"
+end
+
+function main(args)
+    files = trace_files(args)
+    statements, skipped = collect_statements(files)
+    println("Collected $(length(statements)) precompile statements from ",
+            "$(length(files)) trace(s), skipped $skipped runtime-only")
+
+    mkpath(BUILD_DIR)
+    statements_file = joinpath(BUILD_DIR, "precompile_statements.jl")
+    write(statements_file, join(statements, "\n"), "\n")
+
+    sysimage = joinpath(BUILD_DIR, "sysimage.$dlext")
+    PackageCompiler.create_sysimage(;
+                                    sysimage_path = sysimage,
+                                    precompile_execution_file = joinpath(@__DIR__,
+                                                                         "precompile.jl"),
+                                    precompile_statements_file = statements_file)
+
+    traces = [Dict("path" => f, "mtime" => mtime(f), "size" => filesize(f))
+              for f in files]
+    manifest = Dict("julia" => string(VERSION),
+                    "created" => time(),
+                    "traceDir" => isempty(args) ? TRACE_DIR : nothing,
+                    "traces" => traces,
+                    "statements" => length(statements))
+    write(joinpath(BUILD_DIR, "sysimage.json"), json(manifest), "\n")
+    println("Wrote $sysimage")
+end
+
+main(ARGS)
@@ -1,3 +1,18 @@
+# Workload run while building the sysimage, in addition to the traced
+# statements. It covers calls jlbun makes for any script: arrays, type names
+# and properties used to wrap values, keyword calls and tasks.
 a = zeros(10)
 b = map(sqrt, a)
 map!(sqrt, a, a)
+
+for x in (1, 1.0, "s", :s, a, (1, 2.0), (a = 1,), 1 => 2, Dict("a" => 1),
+          Set([1]), 1:2, view(a, 1:2), 1.0 + 2.0im)
+    string(x)
+    string(typeof(x))
+    propertynames(x)
+end
+fieldnames(typeof((a = 1,)))
+names(Base)
+sort!([3, 1, 2]; rev = true, by = string)
+IdDict{Any, Any}()[1] = 2
+fetch(Threads.@spawn sum(1:10))